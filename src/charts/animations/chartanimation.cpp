@@ -28,12 +28,14 @@
 ****************************************************************************/
 
 #include <private/chartanimation_p.h>
+#include <QtCore/QTimer>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
 ChartAnimation::ChartAnimation(QObject *parent) :
     QVariantAnimation(parent),
-    m_destructing(false)
+    m_destructing(false),
+    m_startPending(false)
 {
 }
 
@@ -44,10 +46,37 @@ void ChartAnimation::stopAndDestroyLater()
     deleteLater();
 }
 
+// Starts the animation once control returns to the event loop, so that several changes made
+// in a row only start it once.
+void ChartAnimation::queueStart()
+{
+    m_startPending = true;
+    QTimer::singleShot(0, this, SLOT(startChartAnimation()));
+}
+
+// Stops the animation and drops a queued start, for changes that are shown without animation.
+void ChartAnimation::cancel()
+{
+    m_startPending = false;
+    stop();
+}
+
+// Returns the milliseconds elapsed since the previous call, or -1 on the first call.
+qint64 ChartAnimation::updateInterval()
+{
+    if (!m_updateTimer.isValid()) {
+        m_updateTimer.start();
+        return -1;
+    }
+    return m_updateTimer.restart();
+}
+
 void ChartAnimation::startChartAnimation()
 {
-    if (!m_destructing)
+    if (!m_destructing && m_startPending) {
+        m_startPending = false;
         start();
+    }
 }
 
 QT_CHARTS_END_NAMESPACE
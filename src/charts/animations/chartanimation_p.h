@@ -41,6 +41,7 @@
 
 #include <QtCharts/QChartGlobal>
 #include <QtCore/QVariantAnimation>
+#include <QtCore/QElapsedTimer>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -53,12 +54,17 @@ public:
     ChartAnimation(QObject *parent = 0);
 
     void stopAndDestroyLater();
+    void queueStart();
+    virtual void cancel();
+    qint64 updateInterval();
 
 public Q_SLOTS:
     void startChartAnimation();
 
 protected:
     bool m_destructing;
+    bool m_startPending;
+    QElapsedTimer m_updateTimer;
 };
 
 QT_CHARTS_END_NAMESPACE
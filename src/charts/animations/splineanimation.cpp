@@ -31,9 +31,6 @@
 #include <private/splinechartitem_p.h>
 #include <QtCore/QDebug>
 
-Q_DECLARE_METATYPE(QVector<QPointF>)
-Q_DECLARE_METATYPE(SplineVector)
-
 QT_CHARTS_BEGIN_NAMESPACE
 
 SplineAnimation::SplineAnimation(SplineChartItem *item, int duration, QEasingCurve &curve)
@@ -118,70 +115,46 @@ void SplineAnimation::setup(QVector<QPointF> &oldPoints, QVector<QPointF> &newPo
         m_type = ReplacePointAnimation;
     }
 
-
-    setKeyValueAt(0.0, qVariantFromValue(m_oldSpline));
-    setKeyValueAt(1.0, qVariantFromValue(m_newSpline));
-
     m_valid = true;
 
 }
 
-QVariant SplineAnimation::interpolated(const QVariant &start, const QVariant &end, qreal progress) const
+void SplineAnimation::updateCurrentValue(const QVariant &value)
 {
-
-    SplineVector startPair = qvariant_cast< SplineVector >(start);
-    SplineVector endPair = qvariant_cast< SplineVector >(end);
-    SplineVector result;
-
-    switch (animationType()) {
-    case RemovePointAnimation:
-    case AddPointAnimation:
-    case ReplacePointAnimation: {
-        if (startPair.first.count() != endPair.first.count())
-            break;
-        Q_ASSERT(startPair.first.count() * 2 - 2 == startPair.second.count());
-        Q_ASSERT(endPair.first.count() * 2 - 2 == endPair.second.count());
-        for (int i = 0; i < endPair.first.count(); i++) {
-            qreal x = startPair.first[i].x() + ((endPair.first[i].x() - startPair.first[i].x()) * progress);
-            qreal y = startPair.first[i].y() + ((endPair.first[i].y() - startPair.first[i].y()) * progress);
-            result.first << QPointF(x, y);
-            if (i + 1 >= endPair.first.count())
-                continue;
-            x = startPair.second[i * 2].x() + ((endPair.second[i * 2].x() - startPair.second[i * 2].x()) * progress);
-            y = startPair.second[i * 2].y() + ((endPair.second[i * 2].y() - startPair.second[i * 2].y()) * progress);
-            result.second << QPointF(x, y);
-            x = startPair.second[i * 2 + 1].x() + ((endPair.second[i * 2 + 1].x() - startPair.second[i * 2 + 1].x()) * progress);
-            y = startPair.second[i * 2 + 1].y() + ((endPair.second[i * 2 + 1].y() - startPair.second[i * 2 + 1].y()) * progress);
-            result.second << QPointF(x, y);
-        }
-    }
-    break;
-    case NewAnimation: {
-        Q_ASSERT(endPair.first.count() * 2 - 2 == endPair.second.count());
-        int count = endPair.first.count() * qBound(qreal(0), progress, qreal(1));
-        for (int i = 0; i < count; i++) {
-            result.first << endPair.first[i];
-            if (i + 1 == count)
+    if (state() != QAbstractAnimation::Stopped && m_valid) { //workaround
+        const qreal progress = value.toReal();
+        QVector<QPointF> &points = m_item->geometryBuffer();
+        QVector<QPointF> &controlPoints = m_item->controlGeometryBuffer();
+
+        switch (animationType()) {
+        case RemovePointAnimation:
+        case AddPointAnimation:
+        case ReplacePointAnimation: {
+            if (m_oldSpline.first.count() != m_newSpline.first.count()) {
+                points.clear();
+                controlPoints.clear();
                 break;
-            result.second << endPair.second[2 * i];
-            result.second << endPair.second[2 * i + 1];
+            }
+            Q_ASSERT(m_oldSpline.first.count() * 2 - 2 == m_oldSpline.second.count());
+            Q_ASSERT(m_newSpline.first.count() * 2 - 2 == m_newSpline.second.count());
+            interpolatePoints(points, m_oldSpline.first, m_newSpline.first, progress);
+            interpolatePoints(controlPoints, m_oldSpline.second, m_newSpline.second, progress);
         }
-    }
-    break;
-    default:
-        qWarning() << "Unknown type of animation";
         break;
-    }
-
-    return qVariantFromValue(result);
-}
+        case NewAnimation: {
+            Q_ASSERT(m_newSpline.first.count() * 2 - 2 == m_newSpline.second.count());
+            int count = m_newSpline.first.count() * qBound(qreal(0), progress, qreal(1));
+            copyPoints(points, m_newSpline.first, count);
+            copyPoints(controlPoints, m_newSpline.second, 2 * count - 2);
+        }
+        break;
+        default:
+            qWarning() << "Unknown type of animation";
+            break;
+        }
 
-void SplineAnimation::updateCurrentValue(const QVariant &value)
-{
-    if (state() != QAbstractAnimation::Stopped && m_valid) { //workaround
-        QPair<QVector<QPointF >, QVector<QPointF > > pair = qvariant_cast< QPair< QVector<QPointF>, QVector<QPointF> > >(value);
-        m_item->setGeometryPoints(pair.first);
-        m_item->setControlGeometryPoints(pair.second);
+        m_item->swapGeometryBuffer();
+        m_item->swapControlGeometryBuffer();
         m_item->updateGeometry();
         m_item->setDirty(true);
         m_dirty = false;
@@ -208,6 +181,7 @@ void SplineAnimation::updateState(QAbstractAnimation::State newState, QAbstractA
             m_item->setGeometryPoints(m_newSpline.first);
             m_item->setControlGeometryPoints(m_newSpline.second);
         }
+        m_item->controlGeometryBuffer() = QVector<QPointF>();
     }
 
     if (oldState == QAbstractAnimation::Stopped && newState == QAbstractAnimation::Running) {
@@ -55,7 +55,6 @@ public:
     void setup(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, QVector<QPointF> &oldContorlPoints, QVector<QPointF> &newControlPoints, int index = -1);
 
 protected:
-    QVariant interpolated(const QVariant &start, const QVariant &end, qreal progress) const;
     void updateCurrentValue(const QVariant &value);
     void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState);
 
@@ -30,11 +30,21 @@
 #include <private/xyanimation_p.h>
 #include <private/xychart_p.h>
 #include <QtCore/QDebug>
-
-Q_DECLARE_METATYPE(QVector<QPointF>)
+#include <QtCore/QtMath>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Resizes the buffer to count points. The memory of the buffer is reused unless something else
+// still refers to it, in which case writing to it would first copy all the points.
+static QPointF *prepareBuffer(QVector<QPointF> &buffer, int count)
+{
+    if (!buffer.isDetached())
+        buffer = QVector<QPointF>();
+    buffer.resize(count);
+    return buffer.data();
+}
+
 XYAnimation::XYAnimation(XYChart *item, int duration, QEasingCurve &curve)
     : ChartAnimation(item),
       m_type(NewAnimation),
@@ -44,6 +54,10 @@ XYAnimation::XYAnimation(XYChart *item, int duration, QEasingCurve &curve)
 {
     setDuration(duration);
     setEasingCurve(curve);
+    // The animated value is the eased progress. The points of each frame are interpolated
+    // directly into the geometry buffer of the item instead of passing them in variants.
+    setStartValue(qreal(0));
+    setEndValue(qreal(1));
 }
 
 XYAnimation::~XYAnimation()
@@ -82,9 +96,9 @@ void XYAnimation::setup(const QVector<QPointF> &oldPoints, const QVector<QPointF
         m_type = RemovePointAnimation;
     }
 
-    if (diff == -1 && requestedDiff == -1 && index >= 0 && index <= x) {
-        //add point
-        m_oldPoints.insert(index, index > 0 ? newPoints[index - 1] : newPoints[index]);
+    if (diff < 0 && requestedDiff == diff && index >= 0 && index <= x) {
+        //add points, a batch of them grows out from the same point
+        m_oldPoints.insert(index, -diff, index > 0 ? newPoints[index - 1] : newPoints[index]);
         m_index = index;
         m_type = AddPointAnimation;
     }
@@ -96,52 +110,63 @@ void XYAnimation::setup(const QVector<QPointF> &oldPoints, const QVector<QPointF
         m_type = NewAnimation;
     else if (m_type == NewAnimation)
         m_type = ReplacePointAnimation;
-
-    setKeyValueAt(0.0, qVariantFromValue(m_oldPoints));
-    setKeyValueAt(1.0, qVariantFromValue(m_newPoints));
 }
 
-QVariant XYAnimation::interpolated(const QVariant &start, const QVariant &end, qreal progress) const
+void XYAnimation::cancel()
 {
-    QVector<QPointF> startVector = qvariant_cast<QVector<QPointF> >(start);
-    QVector<QPointF> endVector = qvariant_cast<QVector<QPointF> >(end);
-    QVector<QPointF> result;
-
-    switch (m_type) {
-
-    case ReplacePointAnimation:
-    case AddPointAnimation:
-    case RemovePointAnimation: {
-        if (startVector.count() != endVector.count())
-            break;
-
-        for (int i = 0; i < startVector.count(); i++) {
-            qreal x = startVector[i].x() + ((endVector[i].x() - startVector[i].x()) * progress);
-            qreal y = startVector[i].y() + ((endVector[i].y() - startVector[i].y()) * progress);
-            result << QPointF(x, y);
-        }
+    ChartAnimation::cancel();
+    // The next setup starts from the points shown, not from those of the cancelled animation
+    m_dirty = false;
+}
 
+void XYAnimation::interpolatePoints(QVector<QPointF> &result, const QVector<QPointF> &start,
+                                    const QVector<QPointF> &end, qreal progress)
+{
+    if (start.count() != end.count()) {
+        result.clear();
+        return;
     }
-    break;
-    case NewAnimation: {
-        for (int i = 0; i < endVector.count() * qBound(qreal(0), progress, qreal(1)); i++)
-            result << endVector[i];
-    }
-    break;
-    default:
-        qWarning() << "Unknown type of animation";
-        break;
+
+    const int count = end.count();
+    QPointF *resultData = prepareBuffer(result, count);
+    const QPointF *startData = start.constData();
+    const QPointF *endData = end.constData();
+    for (int i = 0; i < count; i++) {
+        qreal x = startData[i].x() + ((endData[i].x() - startData[i].x()) * progress);
+        qreal y = startData[i].y() + ((endData[i].y() - startData[i].y()) * progress);
+        resultData[i] = QPointF(x, y);
     }
+}
 
-    return qVariantFromValue(result);
+void XYAnimation::copyPoints(QVector<QPointF> &result, const QVector<QPointF> &source, int count)
+{
+    count = qBound(0, count, source.count());
+    std::copy(source.constBegin(), source.constBegin() + count, prepareBuffer(result, count));
 }
 
 void XYAnimation::updateCurrentValue(const QVariant &value)
 {
     if (state() != QAbstractAnimation::Stopped) { //workaround
 
-        QVector<QPointF> vector = qvariant_cast<QVector<QPointF> >(value);
-        m_item->setGeometryPoints(vector);
+        const qreal progress = value.toReal();
+        QVector<QPointF> &points = m_item->geometryBuffer();
+
+        switch (m_type) {
+        case ReplacePointAnimation:
+        case AddPointAnimation:
+        case RemovePointAnimation:
+            interpolatePoints(points, m_oldPoints, m_newPoints, progress);
+            break;
+        case NewAnimation:
+            copyPoints(points, m_newPoints,
+                       qCeil(m_newPoints.count() * qBound(qreal(0), progress, qreal(1))));
+            break;
+        default:
+            qWarning() << "Unknown type of animation";
+            break;
+        }
+
+        m_item->swapGeometryBuffer();
         m_item->updateGeometry();
         m_item->setDirty(true);
         m_dirty = false;
@@ -157,6 +182,8 @@ void XYAnimation::updateState(QAbstractAnimation::State newState, QAbstractAnima
                 m_newPoints.remove(m_index);
             m_item->setGeometryPoints(m_newPoints);
         }
+        // Don't keep the points of the previous frame around between animations
+        m_item->geometryBuffer() = QVector<QPointF>();
     }
 }
 
@@ -54,13 +54,17 @@ public:
     XYAnimation(XYChart *item, int duration, QEasingCurve &curve);
     ~XYAnimation();
     void setup(const QVector<QPointF> &oldPoints, const QVector<QPointF> &newPoints, int index = -1);
+    void cancel();
     Animation animationType() const { return m_type; };
 
 protected:
-    QVariant interpolated(const QVariant &start, const QVariant &end, qreal progress) const;
     void updateCurrentValue(const QVariant &value);
     void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState);
     XYChart *chartItem() { return m_item; }
+
+    static void interpolatePoints(QVector<QPointF> &result, const QVector<QPointF> &start,
+                                  const QVector<QPointF> &end, qreal progress);
+    static void copyPoints(QVector<QPointF> &result, const QVector<QPointF> &source, int count);
 protected:
     Animation m_type;
     bool m_dirty;
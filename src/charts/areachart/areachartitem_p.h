@@ -117,6 +117,8 @@ public:
         // We do not actually want to draw anything from LineChartItem.
         // Drawing is done in AreaChartItem only.
         setVisible(false);
+        // Area chart matches the points of the bounds by index, so they are not culled.
+        m_cullingEnabled = false;
     }
     ~AreaBoundItem() {}
 
@@ -135,6 +137,18 @@ public:
         }
     }
 
+    void appendGeometry(const QVector<QPointF> &points)
+    {
+        // Area path is built from the whole line path, so do the full update.
+        XYChart::appendGeometry(points);
+    }
+
+    void applyGeometryTask(const XYGeometryTask *task)
+    {
+        LineChartItem::applyGeometryTask(task);
+        m_item->updatePath();
+    }
+
 private:
     AreaChartItem *m_item;
 };
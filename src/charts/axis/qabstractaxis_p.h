@@ -94,6 +94,8 @@ Q_SIGNALS:
     void rangeChanged(qreal min, qreal max);
 
 protected:
+    const QList<QAbstractSeries *> &series() const { return m_series; }
+
     QAbstractAxis *q_ptr;
     QChart *m_chart;
     QScopedPointer<ChartAxisElement> m_item;
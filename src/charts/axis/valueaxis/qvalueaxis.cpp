@@ -38,6 +38,8 @@
 #include <private/chartpresenter_p.h>
 #include <private/charttheme_p.h>
 #include <private/charthelpers_p.h>
+#include <private/qxyseries_p.h>
+#include <QtCharts/QXYSeries>
 
 QT_CHARTS_BEGIN_NAMESPACE
 /*!
@@ -151,6 +153,26 @@ QT_CHARTS_BEGIN_NAMESPACE
   the default QLocale of the application.
 */
 
+/*!
+  \property QValueAxis::autoFitVisibleRange
+  Defines whether a vertical axis fits its range to the visible part of the attached series.
+  When \c true, the range is set to the minimum and maximum y values of the XY series points
+  that lie within the horizontal range of the chart every time that range changes, for example
+  when the chart is scrolled or zoomed. The property has no effect on horizontal axes.
+  The default value is \c false.
+
+  The points in range are looked up with QXYSeries::boundingRect(), which is fast for series
+  whose x values are in ascending order.
+*/
+/*!
+  \qmlproperty bool ValueAxis::autoFitVisibleRange
+  Defines whether a vertical axis fits its range to the visible part of the attached series.
+  When \c true, the range is set to the minimum and maximum y values of the XY series points
+  that lie within the horizontal range of the chart every time that range changes, for example
+  when the chart is scrolled or zoomed. The property has no effect on horizontal axes.
+  The default value is \c false.
+*/
+
 /*!
   \fn void QValueAxis::minChanged(qreal min)
   Axis emits signal when \a min of axis has changed.
@@ -201,6 +223,17 @@ QT_CHARTS_BEGIN_NAMESPACE
   Axis emits signal when \a format of axis labels has changed.
 */
 
+/*!
+  \fn void QValueAxis::autoFitVisibleRangeChanged(bool enabled)
+  Axis emits signal when fitting the range to the visible part of the series is \a enabled or
+  disabled.
+*/
+/*!
+  \qmlsignal ValueAxis::autoFitVisibleRangeChanged(bool enabled)
+  Axis emits signal when fitting the range to the visible part of the series is \a enabled or
+  disabled.
+*/
+
 /*!
     Constructs an axis object which is a child of \a parent.
 */
@@ -306,6 +339,23 @@ QString QValueAxis::labelFormat() const
     return d->m_format;
 }
 
+void QValueAxis::setAutoFitVisibleRange(bool enabled)
+{
+    Q_D(QValueAxis);
+    if (d->m_autoFitVisibleRange != enabled) {
+        d->m_autoFitVisibleRange = enabled;
+        emit autoFitVisibleRangeChanged(enabled);
+        if (enabled)
+            d->fitVisibleRange();
+    }
+}
+
+bool QValueAxis::autoFitVisibleRange() const
+{
+    Q_D(const QValueAxis);
+    return d->m_autoFitVisibleRange;
+}
+
 /*!
   Returns the type of the axis
 */
@@ -343,7 +393,8 @@ QValueAxisPrivate::QValueAxisPrivate(QValueAxis *q)
       m_tickCount(5),
       m_minorTickCount(0),
       m_format(QString::null),
-      m_applying(false)
+      m_applying(false),
+      m_autoFitVisibleRange(false)
 {
 
 }
@@ -457,6 +508,10 @@ void QValueAxisPrivate::initializeDomain(AbstractDomain *domain)
             domain->setRangeY(m_min, m_max);
         else
             setRange(domain->minY(), domain->maxY());
+        QObject::connect(domain, SIGNAL(rangeHorizontalChanged(qreal,qreal)),
+                         this, SLOT(handleHorizontalRangeChanged()), Qt::UniqueConnection);
+        if (m_autoFitVisibleRange)
+            fitVisibleRange();
     }
     if (orientation() == Qt::Horizontal) {
         if (!qFuzzyIsNull(m_max - m_min))
@@ -466,6 +521,50 @@ void QValueAxisPrivate::initializeDomain(AbstractDomain *domain)
     }
 }
 
+void QValueAxisPrivate::fitVisibleRange()
+{
+    if (orientation() != Qt::Vertical)
+        return;
+
+    bool found = false;
+    qreal min = 0;
+    qreal max = 0;
+    foreach (QAbstractSeries *series, this->series()) {
+        if (series->type() != QAbstractSeries::SeriesTypeLine
+            && series->type() != QAbstractSeries::SeriesTypeSpline
+            && series->type() != QAbstractSeries::SeriesTypeScatter) {
+            continue;
+        }
+        QXYSeries *xySeries = static_cast<QXYSeries *>(series);
+        AbstractDomain *domain = QXYSeriesPrivate::get(xySeries)->domain();
+        QRectF bounds;
+        if (!domain || !xySeries->boundingRect(domain->minX(), domain->maxX(), &bounds))
+            continue;
+        if (!found) {
+            min = bounds.top();
+            max = bounds.bottom();
+            found = true;
+        } else {
+            min = qMin(min, bounds.top());
+            max = qMax(max, bounds.bottom());
+        }
+    }
+
+    if (!found)
+        return;
+    if (min == max) {
+        min -= 0.5;
+        max += 0.5;
+    }
+    setRange(min, max);
+}
+
+void QValueAxisPrivate::handleHorizontalRangeChanged()
+{
+    if (m_autoFitVisibleRange)
+        fitVisibleRange();
+}
+
 #include "moc_qvalueaxis.cpp"
 #include "moc_qvalueaxis_p.cpp"
 
@@ -44,6 +44,7 @@ class QT_CHARTS_EXPORT QValueAxis : public QAbstractAxis
     Q_PROPERTY(qreal max READ max WRITE setMax NOTIFY maxChanged)
     Q_PROPERTY(QString labelFormat READ labelFormat WRITE setLabelFormat NOTIFY labelFormatChanged)
     Q_PROPERTY(int minorTickCount READ minorTickCount WRITE setMinorTickCount NOTIFY minorTickCountChanged)
+    Q_PROPERTY(bool autoFitVisibleRange READ autoFitVisibleRange WRITE setAutoFitVisibleRange NOTIFY autoFitVisibleRangeChanged)
 
 public:
     explicit QValueAxis(QObject *parent = Q_NULLPTR);
@@ -71,6 +72,9 @@ public:
     void setLabelFormat(const QString &format);
     QString labelFormat() const;
 
+    void setAutoFitVisibleRange(bool enabled);
+    bool autoFitVisibleRange() const;
+
 public Q_SLOTS:
     void applyNiceNumbers();
 
@@ -81,6 +85,7 @@ Q_SIGNALS:
     void tickCountChanged(int tickCount);
     void minorTickCountChanged(int tickCount);
     void labelFormatChanged(const QString &format);
+    void autoFitVisibleRangeChanged(bool enabled);
 
 private:
     Q_DECLARE_PRIVATE(QValueAxis)
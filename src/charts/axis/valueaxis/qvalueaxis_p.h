@@ -58,6 +58,10 @@ public:
     qreal min() { return m_min; }
     qreal max() { return m_max; }
     void setRange(qreal min,qreal max);
+    void fitVisibleRange();
+
+public Q_SLOTS:
+    void handleHorizontalRangeChanged();
 
 protected:
     void setMin(const QVariant &min);
@@ -71,6 +75,7 @@ private:
     int m_minorTickCount;
     QString m_format;
     bool m_applying;
+    bool m_autoFitVisibleRange;
     Q_DECLARE_PUBLIC(QValueAxis)
 };
 
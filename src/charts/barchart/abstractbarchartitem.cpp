@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/abstractbarchartitem_p.h>
-#include <private/bar_p.h>
 #include <QtCharts/QBarSet>
 #include <private/qbarset_p.h>
 #include <QtCharts/QAbstractBarSeries>
@@ -40,18 +39,40 @@
 
 #include <private/chartdataset_p.h>
 #include <QtGui/QPainter>
-#include <QtGui/QTextDocument>
+#include <QtCore/QtMath>
+#include <QtWidgets/QGraphicsSceneEvent>
+#include <QtWidgets/QStyleOptionGraphicsItem>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+static inline bool isHorizontalBarSeries(QAbstractSeries::SeriesType type)
+{
+    return type == QAbstractSeries::SeriesTypeHorizontalBar
+            || type == QAbstractSeries::SeriesTypeHorizontalStackedBar
+            || type == QAbstractSeries::SeriesTypeHorizontalPercentBar;
+}
+
+// Unlike QRectF::intersects(), accepts bars of zero width or height, which still get an outline
+static inline bool overlaps(const QRectF &rect, const QRectF &area)
+{
+    return rect.right() >= area.left() && rect.left() <= area.right()
+            && rect.bottom() >= area.top() && rect.top() <= area.bottom();
+}
+
 AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphicsItem* item) :
     ChartItem(series->d_func(),item),
     m_animation(0),
-    m_series(series)
+    m_series(series),
+    m_hoveredIndex(-1),
+    m_hoveredCategory(-1),
+    m_hoveredSet(0),
+    m_pressedCategory(-1),
+    m_pressedSet(0)
 {
 
-    setFlag(ItemClipsChildrenToShape);
     setFlag(QGraphicsItem::ItemIsSelectable);
+    setAcceptedMouseButtons(Qt::LeftButton | Qt::RightButton);
+    setAcceptHoverEvents(true);
     connect(series->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleLayoutChanged()));
     connect(series->d_func(), SIGNAL(updatedBars()), this, SLOT(handleUpdatedBars()));
     connect(series->d_func(), SIGNAL(labelsVisibleChanged(bool)), this, SLOT(handleLabelsVisibleChanged(bool)));
@@ -75,9 +96,60 @@ AbstractBarChartItem::~AbstractBarChartItem()
 
 void AbstractBarChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    Q_UNUSED(painter);
-    Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    const int setCount = m_series->count();
+    if (setCount == 0 || m_layout.count() != m_labels.count())
+        return;
+
+    const QRectF clipRect = m_rect.intersected(option->exposedRect);
+    painter->save();
+    painter->setClipRect(clipRect);
+
+    // Bars of one set share the pen and brush, so each set is drawn with a single call
+    for (int set = 0; set < setCount; set++) {
+        QBarSetPrivate *barSet = m_series->d_func()->barsetAt(set)->d_ptr.data();
+        const qreal penWidth = barSet->m_pen.widthF();
+        const QRectF area = clipRect.adjusted(-penWidth, -penWidth, penWidth, penWidth);
+        m_paintRects.resize(0);
+        for (int i = set; i < m_layout.count(); i += setCount) {
+            if (overlaps(m_layout.at(i), area))
+                m_paintRects.append(m_layout.at(i));
+        }
+        painter->setPen(barSet->m_pen);
+        painter->setBrush(barSet->m_brush);
+        painter->drawRects(m_paintRects.constData(), m_paintRects.count());
+    }
+
+    if (m_series->isLabelsVisible()) {
+        const qreal angle = m_series->d_func()->labelsAngle();
+        const qreal margin = ChartPresenter::textMargin();
+        for (int set = 0; set < setCount; set++) {
+            QBarSetPrivate *barSet = m_series->d_func()->barsetAt(set)->d_ptr.data();
+            painter->setFont(barSet->m_labelFont);
+            painter->setPen(barSet->m_labelBrush.color());
+            for (int i = set; i < m_labels.count(); i += setCount) {
+                const QStaticText &label = m_labels.at(i);
+                if (label.text().isEmpty())
+                    continue;
+                const QRectF labelRect(m_labelPositions.at(i), labelSize(i));
+                if (angle == 0.0) {
+                    if (labelRect.intersects(clipRect))
+                        painter->drawStaticText(labelRect.topLeft() + QPointF(margin, margin), label);
+                } else {
+                    // Rotate around the center of the label, like the label items used to
+                    painter->save();
+                    painter->translate(labelRect.center());
+                    painter->rotate(angle);
+                    painter->drawStaticText(QPointF(margin - labelRect.width() / 2,
+                                                    margin - labelRect.height() / 2), label);
+                    painter->restore();
+                }
+            }
+        }
+    }
+
+    painter->restore();
 }
 
 QRectF AbstractBarChartItem::boundingRect() const
@@ -85,6 +157,12 @@ QRectF AbstractBarChartItem::boundingRect() const
     return m_rect;
 }
 
+bool AbstractBarChartItem::contains(const QPointF &point) const
+{
+    // Only the bars take mouse and hover events, the empty space goes to the items below
+    return barIndexAt(point) >= 0;
+}
+
 void AbstractBarChartItem::applyLayout(const QVector<QRectF> &layout)
 {
     QSizeF size = geometry().size();
@@ -110,15 +188,13 @@ void AbstractBarChartItem::setAnimation(BarAnimation *animation)
 
 void AbstractBarChartItem::setLayout(const QVector<QRectF> &layout)
 {
-    if (layout.count() != m_bars.count())
+    if (layout.count() != m_labels.count())
         return;
 
     m_layout = layout;
 
-    for (int i = 0; i < m_bars.count(); i++)
-        m_bars.at(i)->setRect(layout.at(i));
-
     positionLabels();
+    update();
 }
 //handlers
 
@@ -150,49 +226,24 @@ void AbstractBarChartItem::handleLayoutChanged()
 
 void AbstractBarChartItem::handleLabelsVisibleChanged(bool visible)
 {
-    foreach (QGraphicsTextItem *label, m_labels)
-        label->setVisible(visible);
+    Q_UNUSED(visible);
     update();
 }
 
 void AbstractBarChartItem::handleDataStructureChanged()
 {
-    foreach (QGraphicsItem *item, childItems())
-        delete item;
-
-    m_bars.clear();
-    m_labels.clear();
+    // The bars are painted from the layout, so only the label caches follow the structure.
+    // Existing labels are kept and get refreshed in handleUpdatedBars() if their text changed.
+    setHoveredBar(-1);
+    m_pressedCategory = -1;
+    m_pressedSet = 0;
+
+    const int barCount = m_series->d_func()->categoryCount() * m_series->count();
+    m_labels.resize(barCount);
+    m_labelFonts.resize(barCount);
+    m_labelPositions.resize(barCount);
     m_layout.clear();
 
-    // Create new graphic items for bars
-    for (int c = 0; c < m_series->d_func()->categoryCount(); c++) {
-        for (int s = 0; s < m_series->count(); s++) {
-            QBarSet *set = m_series->d_func()->barsetAt(s);
-
-            // Bars
-            Bar *bar = new Bar(set, c, this);
-            m_bars.append(bar);
-            connect(bar, SIGNAL(clicked(int,QBarSet*)), m_series, SIGNAL(clicked(int,QBarSet*)));
-            connect(bar, SIGNAL(hovered(bool, int, QBarSet*)), m_series, SIGNAL(hovered(bool, int, QBarSet*)));
-            connect(bar, SIGNAL(pressed(int, QBarSet*)), m_series, SIGNAL(pressed(int, QBarSet*)));
-            connect(bar, SIGNAL(released(int, QBarSet*)),
-                    m_series, SIGNAL(released(int, QBarSet*)));
-            connect(bar, SIGNAL(doubleClicked(int, QBarSet*)),
-                    m_series, SIGNAL(doubleClicked(int, QBarSet*)));
-            connect(bar, SIGNAL(clicked(int,QBarSet*)), set, SIGNAL(clicked(int)));
-            connect(bar, SIGNAL(hovered(bool, int, QBarSet*)), set, SIGNAL(hovered(bool, int)));
-            connect(bar, SIGNAL(pressed(int, QBarSet*)), set, SIGNAL(pressed(int)));
-            connect(bar, SIGNAL(released(int, QBarSet*)), set, SIGNAL(released(int)));
-            connect(bar, SIGNAL(doubleClicked(int, QBarSet*)), set, SIGNAL(doubleClicked(int)));
-            //            m_layout.append(QRectF(0, 0, 1, 1));
-
-            // Labels
-            QGraphicsTextItem *newLabel = new QGraphicsTextItem(this);
-            newLabel->document()->setDocumentMargin(ChartPresenter::textMargin());
-            m_labels.append(newLabel);
-        }
-    }
-
     if(themeManager()) themeManager()->updateSeries(m_series);
     handleLayoutChanged();
     handleVisibleChanged();
@@ -200,62 +251,44 @@ void AbstractBarChartItem::handleDataStructureChanged()
 
 void AbstractBarChartItem::handleVisibleChanged()
 {
-    bool visible = m_series->isVisible();
-    if (visible)
-        handleLabelsVisibleChanged(m_series->isLabelsVisible());
-    else
-        handleLabelsVisibleChanged(visible);
-
-    foreach (QGraphicsItem *bar, m_bars)
-        bar->setVisible(visible);
+    setVisible(m_series->isVisible());
 }
 
 void AbstractBarChartItem::handleOpacityChanged()
 {
-    foreach (QGraphicsItem *item, childItems())
-        item->setOpacity(m_series->opacity());
+    setOpacity(m_series->opacity());
 }
 
 void AbstractBarChartItem::handleUpdatedBars()
 {
     if (!m_series->d_func()->blockBarUpdate()) {
-        // Handle changes in pen, brush, labels etc.
+        // Pens and brushes are read from the sets when painting, only the labels are cached
         int categoryCount = m_series->d_func()->categoryCount();
         int setCount = m_series->count();
         int itemIndex(0);
         static const QString valueTag(QLatin1String("@value"));
 
-        for (int category = 0; category < categoryCount; category++) {
-            for (int set = 0; set < setCount; set++) {
-                QBarSetPrivate *barSet = m_series->d_func()->barsetAt(set)->d_ptr.data();
-                Bar *bar = m_bars.at(itemIndex);
-                bar->setPen(barSet->m_pen);
-                bar->setBrush(barSet->m_brush);
-                bar->update();
-
-                QGraphicsTextItem *label = m_labels.at(itemIndex);
-                QString valueLabel;
-                if (presenter()) { // At startup presenter is not yet set, yet somehow update comes
-                    if (barSet->value(category) == 0) {
-                        label->setVisible(false);
-                    } else {
-                        label->setVisible(m_series->isLabelsVisible());
+        if (presenter()) { // At startup presenter is not yet set, yet somehow update comes
+            for (int category = 0; category < categoryCount; category++) {
+                for (int set = 0; set < setCount; set++) {
+                    QBarSetPrivate *barSet = m_series->d_func()->barsetAt(set)->d_ptr.data();
+                    QString valueLabel;
+                    if (barSet->value(category) != 0) {
                         if (m_series->labelsFormat().isEmpty()) {
                             valueLabel = presenter()->numberToString(barSet->value(category));
                         } else {
                             valueLabel = m_series->labelsFormat();
                             valueLabel.replace(valueTag,
-                                           presenter()->numberToString(barSet->value(category)));
+                                               presenter()->numberToString(barSet->value(category)));
                         }
                     }
+                    setLabel(itemIndex, valueLabel, barSet->m_labelFont);
+                    itemIndex++;
                 }
-                label->setHtml(valueLabel);
-                label->setFont(barSet->m_labelFont);
-                label->setDefaultTextColor(barSet->m_labelBrush.color());
-                label->update();
-                itemIndex++;
             }
         }
+        positionLabels();
+        update();
     }
 }
 
@@ -274,10 +307,10 @@ void AbstractBarChartItem::positionLabels()
     if (angle != 0.0)
         transform.rotate(angle);
 
-    for (int i = 0; i < m_layout.count(); i++) {
-        QGraphicsTextItem *label = m_labels.at(i);
-
-        QRectF labelRect = label->boundingRect();
+    const int setCount = m_series->count();
+    const int count = qMin(m_layout.count(), m_labels.count());
+    for (int i = 0; i < count; i++) {
+        QRectF labelRect(QPointF(0, 0), labelSize(i));
         QPointF center = labelRect.center();
 
         qreal xPos = 0;
@@ -285,14 +318,12 @@ void AbstractBarChartItem::positionLabels()
 
         int xDiff = 0;
         if (angle != 0.0) {
-            label->setTransformOriginPoint(center.x(), center.y());
-            label->setRotation(m_series->d_func()->labelsAngle());
             qreal oldWidth = labelRect.width();
             labelRect = transform.mapRect(labelRect);
             xDiff = (labelRect.width() - oldWidth) / 2;
         }
 
-        int offset = m_bars.at(i)->pen().width() / 2 + 2;
+        int offset = m_series->d_func()->barsetAt(i % setCount)->d_ptr->m_pen.width() / 2 + 2;
 
         switch (m_series->labelsPosition()) {
         case QAbstractBarSeries::LabelsCenter:
@@ -312,9 +343,9 @@ void AbstractBarChartItem::positionLabels()
             break;
         }
 
-        label->setPos(xPos, yPos);
-        label->setZValue(zValue() + 1);
+        m_labelPositions[i] = QPointF(xPos, yPos);
     }
+    update();
 }
 
 void AbstractBarChartItem::positionLabelsVertical()
@@ -324,10 +355,10 @@ void AbstractBarChartItem::positionLabelsVertical()
     if (angle != 0.0)
         transform.rotate(angle);
 
-    for (int i = 0; i < m_layout.count(); i++) {
-        QGraphicsTextItem *label = m_labels.at(i);
-
-        QRectF labelRect = label->boundingRect();
+    const int setCount = m_series->count();
+    const int count = qMin(m_layout.count(), m_labels.count());
+    for (int i = 0; i < count; i++) {
+        QRectF labelRect(QPointF(0, 0), labelSize(i));
         QPointF center = labelRect.center();
 
         qreal xPos = m_layout.at(i).center().x() - center.x();
@@ -335,14 +366,12 @@ void AbstractBarChartItem::positionLabelsVertical()
 
         int yDiff = 0;
         if (angle != 0.0) {
-            label->setTransformOriginPoint(center.x(), center.y());
-            label->setRotation(m_series->d_func()->labelsAngle());
             qreal oldHeight = labelRect.height();
             labelRect = transform.mapRect(labelRect);
             yDiff = (labelRect.height() - oldHeight) / 2;
         }
 
-        int offset = m_bars.at(i)->pen().width() / 2 + 2;
+        int offset = m_series->d_func()->barsetAt(i % setCount)->d_ptr->m_pen.width() / 2 + 2;
 
         switch (m_series->labelsPosition()) {
         case QAbstractBarSeries::LabelsCenter:
@@ -362,9 +391,151 @@ void AbstractBarChartItem::positionLabelsVertical()
             break;
         }
 
-        label->setPos(xPos, yPos);
-        label->setZValue(zValue() + 1);
+        m_labelPositions[i] = QPointF(xPos, yPos);
+    }
+    update();
+}
+
+void AbstractBarChartItem::setLabel(int index, const QString &text, const QFont &font)
+{
+    // Laying out the text is the expensive part, so only changed labels are prepared again
+    QStaticText &label = m_labels[index];
+    if (label.text() == text && m_labelFonts.at(index) == font)
+        return;
+
+    label.setTextFormat(Qt::RichText);
+    label.setText(text);
+    label.prepare(QTransform(), font);
+    m_labelFonts[index] = font;
+}
+
+QSizeF AbstractBarChartItem::labelSize(int index) const
+{
+    const QStaticText &label = m_labels.at(index);
+    if (label.text().isEmpty())
+        return QSizeF();
+    const qreal margin = 2 * ChartPresenter::textMargin();
+    return label.size() + QSizeF(margin, margin);
+}
+
+int AbstractBarChartItem::barIndexAt(const QPointF &point) const
+{
+    const int setCount = m_series->count();
+    if (setCount == 0 || m_layout.count() != m_labels.count() || !m_rect.contains(point))
+        return -1;
+
+    // Bars of category n are centered on n in the domain, so only the bars of the category
+    // under the point, and of its neighbours when the bars are wider than a category, are tested
+    const QPointF value = domain()->calculateDomainPoint(point);
+    const qreal position = isHorizontalBarSeries(m_series->type()) ? value.y() : value.x();
+    if (!qIsFinite(position))
+        return -1;
+
+    const int categoryCount = m_layout.count() / setCount;
+    const int reach = qCeil(m_series->barWidth() / 2);
+    const int category = qRound(qBound(qreal(-1), position, qreal(categoryCount)));
+    const int first = qMax(0, category - reach);
+    const int last = qMin(categoryCount - 1, category + reach);
+
+    // Later sets are painted on top, so they are hit first
+    for (int set = setCount - 1; set >= 0; set--) {
+        for (int c = last; c >= first; c--) {
+            const int index = c * setCount + set;
+            if (m_layout.at(index).contains(point))
+                return index;
+        }
+    }
+    return -1;
+}
+
+void AbstractBarChartItem::setHoveredBar(int index)
+{
+    if (index == m_hoveredIndex)
+        return;
+
+    if (m_hoveredSet) {
+        emit m_series->hovered(false, m_hoveredCategory, m_hoveredSet);
+        emit m_hoveredSet->hovered(false, m_hoveredCategory);
+    }
+
+    m_hoveredIndex = index;
+    m_hoveredCategory = -1;
+    m_hoveredSet = 0;
+
+    if (index >= 0) {
+        const int setCount = m_series->count();
+        m_hoveredCategory = index / setCount;
+        m_hoveredSet = m_series->d_func()->barsetAt(index % setCount);
+        emit m_series->hovered(true, m_hoveredCategory, m_hoveredSet);
+        emit m_hoveredSet->hovered(true, m_hoveredCategory);
+    }
+}
+
+void AbstractBarChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = barIndexAt(event->pos());
+    if (index < 0) {
+        event->ignore();
+        return;
+    }
+
+    const int setCount = m_series->count();
+    m_pressedCategory = index / setCount;
+    m_pressedSet = m_series->d_func()->barsetAt(index % setCount);
+    emit m_series->pressed(m_pressedCategory, m_pressedSet);
+    emit m_pressedSet->pressed(m_pressedCategory);
+    event->accept();
+}
+
+void AbstractBarChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    if (!m_pressedSet) {
+        event->ignore();
+        return;
+    }
+
+    QBarSet *set = m_pressedSet;
+    const int category = m_pressedCategory;
+    m_pressedCategory = -1;
+    m_pressedSet = 0;
+    emit m_series->released(category, set);
+    emit set->released(category);
+    emit m_series->clicked(category, set);
+    emit set->clicked(category);
+}
+
+void AbstractBarChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = barIndexAt(event->pos());
+    if (index < 0) {
+        event->ignore();
+        return;
     }
+
+    const int setCount = m_series->count();
+    const int category = index / setCount;
+    QBarSet *set = m_series->d_func()->barsetAt(index % setCount);
+    emit m_series->doubleClicked(category, set);
+    emit set->doubleClicked(category);
+
+    // The second press of a double click is also a press
+    mousePressEvent(event);
+}
+
+void AbstractBarChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    setHoveredBar(barIndexAt(event->pos()));
+}
+
+void AbstractBarChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    setHoveredBar(barIndexAt(event->pos()));
+}
+
+void AbstractBarChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event);
+    setHoveredBar(-1);
 }
 
 #include "moc_abstractbarchartitem_p.cpp"
@@ -44,10 +44,11 @@
 #include <QtCharts/QAbstractBarSeries>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
+#include <QtGui/QStaticText>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class Bar;
+class QBarSet;
 class QAxisCategories;
 class QChart;
 class BarAnimation;
@@ -62,6 +63,7 @@ public:
 public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
     QRectF boundingRect() const;
+    bool contains(const QPointF &point) const;
 
     virtual QVector<QRectF> calculateLayout() = 0;
     virtual void initializeLayout() = 0;
@@ -83,7 +85,18 @@ public Q_SLOTS:
     virtual void positionLabels();
 
 protected:
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+
     void positionLabelsVertical();
+    void setLabel(int index, const QString &text, const QFont &font);
+    QSizeF labelSize(int index) const;
+    int barIndexAt(const QPointF &point) const;
+    void setHoveredBar(int index);
 
     qreal m_domainMinX;
     qreal m_domainMaxX;
@@ -96,9 +109,19 @@ protected:
     BarAnimation *m_animation;
 
     QAbstractBarSeries *m_series; // Not owned.
-    QList<Bar *> m_bars;
-    QList<QGraphicsTextItem *> m_labels;
     QSizeF m_oldSize;
+
+    // Bars are painted straight from m_layout. Each bar has a cached label, indexed like m_layout.
+    QVector<QStaticText> m_labels;
+    QVector<QFont> m_labelFonts;
+    QVector<QPointF> m_labelPositions;
+    QVector<QRectF> m_paintRects;
+
+    int m_hoveredIndex;
+    int m_hoveredCategory;
+    QBarSet *m_hoveredSet;
+    int m_pressedCategory;
+    QBarSet *m_pressedSet;
 };
 
 QT_CHARTS_END_NAMESPACE
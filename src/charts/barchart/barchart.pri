@@ -17,7 +17,6 @@ DEPENDPATH += $$PWD \
     $$PWD/horizontal/percent
 
 SOURCES += \
-    $$PWD/bar.cpp \
     $$PWD/abstractbarchartitem.cpp \
     $$PWD/qabstractbarseries.cpp \  
     $$PWD/qbarset.cpp \
@@ -38,7 +37,6 @@ SOURCES += \
     $$PWD/horizontal/percent/horizontalpercentbarchartitem.cpp
 
 PRIVATE_HEADERS += \
-    $$PWD/bar_p.h \
     $$PWD/qbarset_p.h \
     $$PWD/abstractbarchartitem_p.h \
     $$PWD/qabstractbarseries_p.h \
@@ -30,7 +30,6 @@
 #include <private/horizontalpercentbarchartitem_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <private/qbarset_p.h>
-#include <private/bar_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -109,7 +108,7 @@ QVector<QRectF> HorizontalPercentBarChartItem::calculateLayout()
 
 void HorizontalPercentBarChartItem::handleUpdatedBars()
 {
-    // Handle changes in pen, brush, labels etc.
+    // Pens and brushes are read from the sets when painting, only the labels are cached
     int categoryCount = m_series->d_func()->categoryCount();
     int setCount = m_series->count();
     int itemIndex(0);
@@ -118,19 +117,10 @@ void HorizontalPercentBarChartItem::handleUpdatedBars()
     for (int category = 0; category < categoryCount; category++) {
         for (int set = 0; set < setCount; set++) {
             QBarSetPrivate *barSet = m_series->d_func()->barsetAt(set)->d_ptr.data();
-            Bar *bar = m_bars.at(itemIndex);
-            bar->setPen(barSet->m_pen);
-            bar->setBrush(barSet->m_brush);
-            bar->update();
-
-            QGraphicsTextItem *label = m_labels.at(itemIndex);
             qreal p = m_series->d_func()->percentageAt(set, category) * 100.0;
-            QString vString(presenter()->numberToString(p, 'f', 0));
             QString valueLabel;
-            if (p == 0) {
-                label->setVisible(false);
-            } else {
-                label->setVisible(m_series->isLabelsVisible());
+            if (p != 0) {
+                QString vString(presenter()->numberToString(p, 'f', 0));
                 if (m_series->labelsFormat().isEmpty()) {
                     vString.append(QStringLiteral("%"));
                     valueLabel = vString;
@@ -139,13 +129,12 @@ void HorizontalPercentBarChartItem::handleUpdatedBars()
                     valueLabel.replace(valueTag, vString);
                 }
             }
-            label->setHtml(valueLabel);
-            label->setFont(barSet->m_labelFont);
-            label->setDefaultTextColor(barSet->m_labelBrush.color());
-            label->update();
+            setLabel(itemIndex, valueLabel, barSet->m_labelFont);
             itemIndex++;
         }
     }
+    positionLabels();
+    update();
 }
 
 #include "moc_horizontalpercentbarchartitem_p.cpp"
@@ -599,20 +599,24 @@ QAbstractBarSeriesPrivate::QAbstractBarSeriesPrivate(QAbstractBarSeries *q) :
     m_blockBarUpdate(false),
     m_labelsFormat(),
     m_labelsPosition(QAbstractBarSeries::LabelsCenter),
-    m_labelsAngle(0)
+    m_labelsAngle(0),
+    m_aggregatesDirty(true),
+    m_categoryCount(0),
+    m_min(0),
+    m_max(0),
+    m_minX(0),
+    m_maxX(0),
+    m_maxCategorySum(0),
+    m_top(0),
+    m_bottom(0)
 {
 }
 
 int QAbstractBarSeriesPrivate::categoryCount() const
 {
     // No categories defined. return count of longest set.
-    int count = 0;
-    for (int i = 0; i < m_barSets.count(); i++) {
-        if (m_barSets.at(i)->count() > count)
-            count = m_barSets.at(i)->count();
-    }
-
-    return count;
+    updateAggregates();
+    return m_categoryCount;
 }
 
 void QAbstractBarSeriesPrivate::setBarWidth(qreal width)
@@ -647,39 +651,14 @@ void QAbstractBarSeriesPrivate::setLabelsVisible(bool visible)
 
 qreal QAbstractBarSeriesPrivate::min()
 {
-    if (m_barSets.count() <= 0)
-        return 0;
-
-    qreal min = INT_MAX;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->at(j);
-            if (temp < min)
-                min = temp;
-        }
-    }
-    return min;
+    updateAggregates();
+    return m_min;
 }
 
 qreal QAbstractBarSeriesPrivate::max()
 {
-    if (m_barSets.count() <= 0)
-        return 0;
-
-    qreal max = INT_MIN;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->at(j);
-            if (temp > max)
-                max = temp;
-        }
-    }
-
-    return max;
+    updateAggregates();
+    return m_max;
 }
 
 qreal QAbstractBarSeriesPrivate::valueAt(int set, int category)
@@ -709,133 +688,140 @@ qreal QAbstractBarSeriesPrivate::percentageAt(int set, int category)
 
 qreal QAbstractBarSeriesPrivate::categorySum(int category)
 {
-    qreal sum(0);
-    int count = m_barSets.count(); // Count sets
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count())
-            sum += m_barSets.at(set)->at(category);
-    }
-    return sum;
+    updateAggregates();
+    if (category < 0 || category >= m_categoryCount)
+        return 0;
+    return m_categorySums.at(category);
 }
 
 qreal QAbstractBarSeriesPrivate::absoluteCategorySum(int category)
 {
-    qreal sum(0);
-    int count = m_barSets.count(); // Count sets
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count())
-            sum += qAbs(m_barSets.at(set)->at(category));
-    }
-    return sum;
+    updateAggregates();
+    if (category < 0 || category >= m_categoryCount)
+        return 0;
+    return m_absoluteCategorySums.at(category);
 }
 
 qreal QAbstractBarSeriesPrivate::maxCategorySum()
 {
-    qreal max = INT_MIN;
-    int count = categoryCount();
-    for (int i = 0; i < count; i++) {
-        qreal sum = categorySum(i);
-        if (sum > max)
-            max = sum;
-    }
-    return max;
+    updateAggregates();
+    return m_maxCategorySum;
 }
 
 qreal QAbstractBarSeriesPrivate::minX()
 {
-    if (m_barSets.count() <= 0)
-        return 0;
-
-    qreal min = INT_MAX;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_ptr.data()->m_values.at(j).x();
-            if (temp < min)
-                min = temp;
-        }
-    }
-    return min;
+    updateAggregates();
+    return m_minX;
 }
 
 qreal QAbstractBarSeriesPrivate::maxX()
 {
-    if (m_barSets.count() <= 0)
-        return 0;
-
-    qreal max = INT_MIN;
-
-    for (int i = 0; i < m_barSets.count(); i++) {
-        int categoryCount = m_barSets.at(i)->count();
-        for (int j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_ptr.data()->m_values.at(j).x();
-            if (temp > max)
-                max = temp;
-        }
-    }
-
-    return max;
+    updateAggregates();
+    return m_maxX;
 }
 
 qreal QAbstractBarSeriesPrivate::categoryTop(int category)
 {
     // Returns top (sum of all positive values) of category.
     // Returns 0, if all values are negative
-    qreal top(0);
-    int count = m_barSets.count();
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count()) {
-            qreal temp = m_barSets.at(set)->at(category);
-            if (temp > 0) {
-                top += temp;
-            }
-        }
-    }
-    return top;
+    updateAggregates();
+    if (category < 0 || category >= m_categoryCount)
+        return 0;
+    return m_categoryTops.at(category);
 }
 
 qreal QAbstractBarSeriesPrivate::categoryBottom(int category)
 {
     // Returns bottom (sum of all negative values) of category
     // Returns 0, if all values are positive
-    qreal bottom(0);
-    int count = m_barSets.count();
-    for (int set = 0; set < count; set++) {
-        if (category < m_barSets.at(set)->count()) {
-            qreal temp = m_barSets.at(set)->at(category);
-            if (temp < 0) {
-                bottom += temp;
-            }
-        }
-    }
-    return bottom;
+    updateAggregates();
+    if (category < 0 || category >= m_categoryCount)
+        return 0;
+    return m_categoryBottoms.at(category);
 }
 
 qreal QAbstractBarSeriesPrivate::top()
 {
     // Returns top of all categories
-    qreal top(0);
-    int count = categoryCount();
-    for (int i = 0; i < count; i++) {
-        qreal temp = categoryTop(i);
-        if (temp > top)
-            top = temp;
-    }
-    return top;
+    updateAggregates();
+    return m_top;
 }
 
 qreal QAbstractBarSeriesPrivate::bottom()
 {
     // Returns bottom of all categories
-    qreal bottom(0);
-    int count = categoryCount();
-    for (int i = 0; i < count; i++) {
-        qreal temp = categoryBottom(i);
-        if (temp < bottom)
-            bottom = temp;
+    updateAggregates();
+    return m_bottom;
+}
+
+void QAbstractBarSeriesPrivate::invalidateAggregates()
+{
+    m_aggregatesDirty = true;
+}
+
+void QAbstractBarSeriesPrivate::updateAggregates() const
+{
+    if (!m_aggregatesDirty)
+        return;
+
+    int count = 0;
+    for (int i = 0; i < m_barSets.count(); i++)
+        count = qMax(count, m_barSets.at(i)->count());
+
+    m_categoryCount = count;
+    m_categorySums.fill(0, count);
+    m_absoluteCategorySums.fill(0, count);
+    m_categoryTops.fill(0, count);
+    m_categoryBottoms.fill(0, count);
+
+    qreal min = INT_MAX;
+    qreal max = INT_MIN;
+    qreal *sums = m_categorySums.data();
+    qreal *absoluteSums = m_absoluteCategorySums.data();
+    qreal *tops = m_categoryTops.data();
+    qreal *bottoms = m_categoryBottoms.data();
+
+    for (int i = 0; i < m_barSets.count(); i++) {
+        const QVector<qreal> &values = m_barSets.at(i)->d_ptr->m_values;
+        const qreal *data = values.constData();
+        for (int j = 0; j < values.count(); j++) {
+            const qreal y = data[j];
+            if (y < min)
+                min = y;
+            if (y > max)
+                max = y;
+            sums[j] += y;
+            absoluteSums[j] += qAbs(y);
+            if (y > 0)
+                tops[j] += y;
+            else if (y < 0)
+                bottoms[j] += y;
+        }
+    }
+
+    qreal maxCategorySum = INT_MIN;
+    qreal top = 0;
+    qreal bottom = 0;
+    for (int j = 0; j < count; j++) {
+        if (sums[j] > maxCategorySum)
+            maxCategorySum = sums[j];
+        if (tops[j] > top)
+            top = tops[j];
+        if (bottoms[j] < bottom)
+            bottom = bottoms[j];
     }
-    return bottom;
+
+    // The x-coordinate of a value is its index in the set.
+    // Series without sets report zero for the value ranges.
+    const bool empty = m_barSets.isEmpty();
+    m_min = empty ? 0 : min;
+    m_max = empty ? 0 : max;
+    m_minX = empty ? 0 : (count > 0 ? 0 : INT_MAX);
+    m_maxX = empty ? 0 : (count > 0 ? count - 1 : INT_MIN);
+    m_maxCategorySum = maxCategorySum;
+    m_top = top;
+    m_bottom = bottom;
+    m_aggregatesDirty = false;
 }
 
 bool QAbstractBarSeriesPrivate::blockBarUpdate()
@@ -885,10 +871,13 @@ bool QAbstractBarSeriesPrivate::append(QBarSet *set)
         return false; // Fail if set is already in list or set is null.
 
     m_barSets.append(set);
+    QObject::connect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SLOT(invalidateAggregates()));
+    QObject::connect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SLOT(invalidateAggregates()));
     QObject::connect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
     QObject::connect(set->d_ptr.data(), SIGNAL(updatedBars()), this, SIGNAL(updatedBars()));
     QObject::connect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SIGNAL(restructuredBars()));
 
+    invalidateAggregates();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -899,10 +888,13 @@ bool QAbstractBarSeriesPrivate::remove(QBarSet *set)
         return false; // Fail if set is not in list
 
     m_barSets.removeOne(set);
+    QObject::disconnect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SLOT(invalidateAggregates()));
+    QObject::disconnect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SLOT(invalidateAggregates()));
     QObject::disconnect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
     QObject::disconnect(set->d_ptr.data(), SIGNAL(updatedBars()), this, SIGNAL(updatedBars()));
     QObject::disconnect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SIGNAL(restructuredBars()));
 
+    invalidateAggregates();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -918,11 +910,14 @@ bool QAbstractBarSeriesPrivate::append(QList<QBarSet * > sets)
 
     foreach (QBarSet *set, sets) {
         m_barSets.append(set);
+        QObject::connect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SLOT(invalidateAggregates()));
+        QObject::connect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SLOT(invalidateAggregates()));
         QObject::connect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
         QObject::connect(set->d_ptr.data(), SIGNAL(updatedBars()), this, SIGNAL(updatedBars()));
         QObject::connect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SIGNAL(restructuredBars()));
     }
 
+    invalidateAggregates();
     emit restructuredBars(); // this notifies barchartitem
     return true;
 }
@@ -941,11 +936,14 @@ bool QAbstractBarSeriesPrivate::remove(QList<QBarSet * > sets)
 
     foreach (QBarSet *set, sets) {
         m_barSets.removeOne(set);
+        QObject::disconnect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SLOT(invalidateAggregates()));
+        QObject::disconnect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SLOT(invalidateAggregates()));
         QObject::disconnect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
         QObject::disconnect(set->d_ptr.data(), SIGNAL(updatedBars()), this, SIGNAL(updatedBars()));
         QObject::disconnect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SIGNAL(restructuredBars()));
     }
 
+    invalidateAggregates();
     emit restructuredBars();        // this notifies barchartitem
 
     return true;
@@ -957,10 +955,13 @@ bool QAbstractBarSeriesPrivate::insert(int index, QBarSet *set)
         return false; // Fail if set is already in list or set is null.
 
     m_barSets.insert(index, set);
+    QObject::connect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SLOT(invalidateAggregates()));
+    QObject::connect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SLOT(invalidateAggregates()));
     QObject::connect(set->d_ptr.data(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
     QObject::connect(set->d_ptr.data(), SIGNAL(updatedBars()), this, SIGNAL(updatedBars()));
     QObject::connect(set->d_ptr.data(), SIGNAL(restructuredBars()), this, SIGNAL(restructuredBars()));
 
+    invalidateAggregates();
     emit restructuredBars();      // this notifies barchartitem
     return true;
 }
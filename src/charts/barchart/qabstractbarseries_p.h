@@ -42,6 +42,7 @@
 #include <QtCharts/QAbstractBarSeries>
 #include <private/qabstractseries_p.h>
 #include <QtCore/QStringList>
+#include <QtCore/QVector>
 #include <QtCharts/QAbstractSeries>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -109,8 +110,12 @@ Q_SIGNALS:
     void labelsVisibleChanged(bool visible);
     void visibleChanged();
 
+private Q_SLOTS:
+    void invalidateAggregates();
+
 private:
     void populateCategories(QBarCategoryAxis *axis);
+    void updateAggregates() const;
 
 protected:
     QList<QBarSet *> m_barSets;
@@ -123,6 +128,21 @@ protected:
     qreal m_labelsAngle;
 
 private:
+    // Aggregates of all sets, rebuilt in one pass on first use after the values change
+    mutable bool m_aggregatesDirty;
+    mutable int m_categoryCount;
+    mutable qreal m_min;
+    mutable qreal m_max;
+    mutable qreal m_minX;
+    mutable qreal m_maxX;
+    mutable qreal m_maxCategorySum;
+    mutable qreal m_top;
+    mutable qreal m_bottom;
+    mutable QVector<qreal> m_categorySums;
+    mutable QVector<qreal> m_absoluteCategorySums;
+    mutable QVector<qreal> m_categoryTops;
+    mutable QVector<qreal> m_categoryBottoms;
+
     Q_DECLARE_PUBLIC(QAbstractBarSeries)
     friend class HorizontalBarChartItem;
     friend class BarChartItem;
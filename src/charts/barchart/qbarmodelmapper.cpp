@@ -32,6 +32,7 @@
 #include <QtCharts/QAbstractBarSeries>
 #include <QtCharts/QBarSet>
 #include <QtCharts/QChart>
+#include <QtCharts/QModelSectionReader>
 #include <QtCore/QAbstractItemModel>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -272,18 +273,31 @@ void QBarModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex botto
         return;
 
     blockSeriesSignals();
+    // Replace the changed values of each bar set with one call, so the chart is laid out once per set
+    const bool vertical = m_orientation == Qt::Vertical;
+    const int firstSection = vertical ? topLeft.column() : topLeft.row();
+    const int lastSection = vertical ? bottomRight.column() : bottomRight.row();
+    const int firstPos = vertical ? topLeft.row() : topLeft.column();
+    const int lastPos = vertical ? bottomRight.row() : bottomRight.column();
     QModelIndex index;
-    for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
-        for (int column = topLeft.column(); column <= bottomRight.column(); column++) {
-            index = topLeft.sibling(row, column);
-            QBarSet *bar = barSet(index);
-            if (bar) {
-                if (m_orientation == Qt::Vertical)
-                    bar->replace(row - m_first, m_model->data(index).toReal());
-                else
-                    bar->replace(column - m_first, m_model->data(index).toReal());
+    QVector<qreal> values;
+    for (int section = firstSection; section <= lastSection; section++) {
+        QBarSet *bar = 0;
+        int first = -1;
+        values.resize(0);
+        for (int pos = firstPos; pos <= lastPos; pos++) {
+            index = vertical ? topLeft.sibling(pos, section) : topLeft.sibling(section, pos);
+            QBarSet *set = barSet(index);
+            if (set) {
+                if (!bar) {
+                    bar = set;
+                    first = pos - m_first;
+                }
+                values.append(m_model->data(index).toReal());
             }
         }
+        if (bar)
+            bar->replace(first, values.constData(), values.count());
     }
     blockSeriesSignals(false);
 }
@@ -530,6 +544,44 @@ void QBarModelMapperPrivate::barValueChanged(int index)
     initializeBarFromModel();
 }
 
+void QBarModelMapperPrivate::barValuesChanged(int index, int count)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    int barSetIndex = m_barSets.indexOf(qobject_cast<QBarSet *>(QObject::sender()));
+
+    blockModelSignals();
+    for (int j = index; j < index + count; j++)
+        m_model->setData(barModelIndex(barSetIndex + m_firstBarSetSection, j), m_barSets.at(barSetIndex)->at(j));
+    blockModelSignals(false);
+    initializeBarFromModel();
+}
+
+// Returns the values of the bar set in the model section.
+QVector<qreal> QBarModelMapperPrivate::barValuesFromModel(int barSection)
+{
+    if (QModelSectionReader *reader = qobject_cast<QModelSectionReader *>(m_model)) {
+        const bool vertical = m_orientation == Qt::Vertical;
+        int count = qMax(0, (vertical ? m_model->rowCount() : m_model->columnCount()) - m_first);
+        if (m_count != -1)
+            count = qMin(count, m_count);
+        QVector<qreal> values(count);
+        if (reader->readSection(m_orientation, barSection, m_first, count, values.data(), 1))
+            return values;
+    }
+
+    QVector<qreal> values;
+    int posInBar = 0;
+    QModelIndex barIndex = barModelIndex(barSection, posInBar);
+    while (barIndex.isValid()) {
+        values.append(m_model->data(barIndex, Qt::DisplayRole).toDouble());
+        posInBar++;
+        barIndex = barModelIndex(barSection, posInBar);
+    }
+    return values;
+}
+
 void QBarModelMapperPrivate::initializeBarFromModel()
 {
     if (m_model == 0 || m_series == 0)
@@ -542,19 +594,14 @@ void QBarModelMapperPrivate::initializeBarFromModel()
 
     // create the initial bar sets
     for (int i = m_firstBarSetSection; i <= m_lastBarSetSection; i++) {
-        int posInBar = 0;
-        QModelIndex barIndex = barModelIndex(i, posInBar);
         // check if there is such model index
-        if (barIndex.isValid()) {
+        if (barModelIndex(i, 0).isValid()) {
             QBarSet *barSet = new QBarSet(m_model->headerData(i, m_orientation == Qt::Vertical ? Qt::Horizontal : Qt::Vertical).toString());
-            while (barIndex.isValid()) {
-                barSet->append(m_model->data(barIndex, Qt::DisplayRole).toDouble());
-                posInBar++;
-                barIndex = barModelIndex(i, posInBar);
-            }
+            barSet->append(barValuesFromModel(i));
             connect(barSet, SIGNAL(valuesAdded(int,int)), this, SLOT(valuesAdded(int,int)));
             connect(barSet, SIGNAL(valuesRemoved(int,int)), this, SLOT(valuesRemoved(int,int)));
             connect(barSet, SIGNAL(valueChanged(int)), this, SLOT(barValueChanged(int)));
+            connect(barSet, SIGNAL(valuesChanged(int,int)), this, SLOT(barValuesChanged(int,int)));
             connect(barSet, SIGNAL(labelChanged()), this, SLOT(barLabelChanged()));
             m_series->append(barSet);
             m_barSets.append(barSet);
@@ -40,6 +40,7 @@
 #define QBARMODELMAPPER_P_H
 
 #include <QtCore/QObject>
+#include <QtCore/QVector>
 #include <QtCharts/QBarModelMapper>
 
 QT_BEGIN_NAMESPACE
@@ -73,6 +74,7 @@ public Q_SLOTS:
     void valuesRemoved(int index, int count);
     void barLabelChanged();
     void barValueChanged(int index);
+    void barValuesChanged(int index, int count);
     void handleSeriesDestroyed();
 
     void initializeBarFromModel();
@@ -80,6 +82,7 @@ public Q_SLOTS:
 private:
     QBarSet *barSet(QModelIndex index);
     QModelIndex barModelIndex(int barSection, int posInBar);
+    QVector<qreal> barValuesFromModel(int barSection);
     void insertData(int start, int end);
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
@@ -273,6 +273,20 @@ QT_CHARTS_BEGIN_NAMESPACE
     Parameter \a index indicates the position of the modified value.
 */
 
+/*!
+    \fn void QBarSet::valuesChanged(int index, int count)
+    This signal is emitted when a range of values in the set has been replaced at once.
+    Parameter \a index indicates the position of the first modified value.
+    Parameter \a count is the number of modified values.
+    \sa replace()
+*/
+/*!
+    \qmlsignal BarSet::onValuesChanged(int index, int count)
+    This signal is emitted when a range of values in the set has been replaced at once.
+    Parameter \a index indicates the position of the first modified value.
+    Parameter \a count is the number of modified values.
+*/
+
 /*!
     \qmlproperty int BarSet::count
     The count of values on the bar set
@@ -328,9 +342,8 @@ QString QBarSet::label() const
 */
 void QBarSet::append(const qreal value)
 {
-    // Convert to QPointF
     int index = d_ptr->m_values.count();
-    d_ptr->append(QPointF(d_ptr->m_values.count(), value));
+    d_ptr->append(value);
     emit valuesAdded(index, 1);
 }
 
@@ -340,9 +353,19 @@ void QBarSet::append(const qreal value)
     \sa append()
 */
 void QBarSet::append(const QList<qreal> &values)
+{
+    append(values.toVector());
+}
+
+/*!
+    Appends the \a values to the end of the set. The valuesAdded() signal is emitted once for
+    all of the values.
+    \sa append()
+*/
+void QBarSet::append(const QVector<qreal> &values)
 {
     int index = d_ptr->m_values.count();
-    d_ptr->append(values);
+    d_ptr->append(values.constData(), values.count());
     emit valuesAdded(index, values.count());
 }
 
@@ -390,6 +413,22 @@ void QBarSet::replace(const int index, const qreal value)
     }
 }
 
+/*!
+    Replaces \a count values of the set, starting at \a index, with the values pointed to by
+    \a values. Values that would go past the end of the set are ignored. The valuesChanged()
+    signal is emitted once for the replaced values, instead of valueChanged() for each of them.
+    \sa valuesChanged()
+*/
+void QBarSet::replace(const int index, const qreal *values, const int count)
+{
+    if (index < 0 || index >= d_ptr->m_values.count() || count <= 0)
+        return;
+
+    const int replacedCount = qMin(count, d_ptr->m_values.count() - index);
+    d_ptr->replace(index, values, replacedCount);
+    emit valuesChanged(index, replacedCount);
+}
+
 
 /*!
     Returns value of set indexed by \a index.
@@ -399,7 +438,7 @@ qreal QBarSet::at(const int index) const
 {
     if (index < 0 || index >= d_ptr->m_values.count())
         return 0;
-    return d_ptr->m_values.at(index).y();
+    return d_ptr->m_values.at(index);
 }
 
 /*!
@@ -425,8 +464,9 @@ int QBarSet::count() const
 qreal QBarSet::sum() const
 {
     qreal total(0);
+    const qreal *values = d_ptr->m_values.constData();
     for (int i = 0; i < d_ptr->m_values.count(); i++)
-        total += d_ptr->m_values.at(i).y();
+        total += values[i];
     return total;
 }
 
@@ -608,7 +648,7 @@ QBarSetPrivate::~QBarSetPrivate()
 {
 }
 
-void QBarSetPrivate::append(QPointF value)
+void QBarSetPrivate::append(const qreal value)
 {
     if (isValidValue(value)) {
         m_values.append(value);
@@ -616,34 +656,17 @@ void QBarSetPrivate::append(QPointF value)
     }
 }
 
-void QBarSetPrivate::append(QList<QPointF> values)
+void QBarSetPrivate::append(const qreal *values, const int count)
 {
-    for (int i = 0; i < values.count(); i++) {
-        if (isValidValue(values.at(i)))
-            m_values.append(values.at(i));
-    }
-    emit restructuredBars();
-}
-
-void QBarSetPrivate::append(QList<qreal> values)
-{
-    int index = m_values.count();
-    for (int i = 0; i < values.count(); i++) {
-        if (isValidValue(values.at(i))) {
-            m_values.append(QPointF(index, values.at(i)));
-            index++;
-        }
+    m_values.reserve(m_values.count() + count);
+    for (int i = 0; i < count; i++) {
+        if (isValidValue(values[i]))
+            m_values.append(values[i]);
     }
     emit restructuredBars();
 }
 
 void QBarSetPrivate::insert(const int index, const qreal value)
-{
-    m_values.insert(index, QPointF(index, value));
-    emit restructuredBars();
-}
-
-void QBarSetPrivate::insert(const int index, const QPointF value)
 {
     m_values.insert(index, value);
     emit restructuredBars();
@@ -653,44 +676,38 @@ int QBarSetPrivate::remove(const int index, const int count)
 {
     int removeCount = count;
 
-    if ((index < 0) || (m_values.count() == 0))
+    if ((index < 0) || (index >= m_values.count()))
         return 0; // Invalid index or not values in list, remove nothing.
     else if ((index + count) > m_values.count())
         removeCount = m_values.count() - index; // Trying to remove more items than list has. Limit amount to be removed.
 
-    int c = 0;
-    while (c < removeCount) {
-        m_values.removeAt(index);
-        c++;
-    }
+    if (removeCount <= 0)
+        return 0;
+
+    m_values.remove(index, removeCount);
     emit restructuredBars();
     return removeCount;
 }
 
 void QBarSetPrivate::replace(const int index, const qreal value)
-{
-    m_values.replace(index, QPointF(index, value));
-    emit updatedLayout();
-}
-
-void QBarSetPrivate::replace(const int index, const QPointF value)
 {
     m_values.replace(index, value);
     emit updatedLayout();
 }
 
-qreal QBarSetPrivate::pos(const int index)
+void QBarSetPrivate::replace(const int index, const qreal *values, const int count)
 {
-    if (index < 0 || index >= m_values.count())
-        return 0;
-    return m_values.at(index).x();
+    qreal *data = m_values.data() + index;
+    for (int i = 0; i < count; i++)
+        data[i] = values[i];
+    emit updatedLayout();
 }
 
 qreal QBarSetPrivate::value(const int index)
 {
     if (index < 0 || index >= m_values.count())
         return 0;
-    return m_values.at(index).y();
+    return m_values.at(index);
 }
 
 #include "moc_qbarset.cpp"
@@ -59,12 +59,14 @@ public:
 
     void append(const qreal value);
     void append(const QList<qreal> &values);
+    void append(const QVector<qreal> &values);
 
     QBarSet &operator << (const qreal &value);
 
     void insert(const int index, const qreal value);
     void remove(const int index, const int count = 1);
     void replace(const int index, const qreal value);
+    void replace(const int index, const qreal *values, const int count);
     qreal at(const int index) const;
     qreal operator [](const int index) const;
     int count() const;
@@ -109,6 +111,7 @@ Q_SIGNALS:
     void valuesAdded(int index, int count);
     void valuesRemoved(int index, int count);
     void valueChanged(int index);
+    void valuesChanged(int index, int count);
 
 private:
     QScopedPointer<QBarSetPrivate> d_ptr;
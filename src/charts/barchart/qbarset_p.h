@@ -41,6 +41,7 @@
 
 #include <QtCharts/QBarSet>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 #include <QtGui/QFont>
@@ -55,18 +56,15 @@ public:
     QBarSetPrivate(const QString label, QBarSet *parent);
     ~QBarSetPrivate();
 
-    void append(QPointF value);
-    void append(QList<QPointF> values);
-    void append(QList<qreal> values);
+    void append(const qreal value);
+    void append(const qreal *values, const int count);
 
     void insert(const int index, const qreal value);
-    void insert(const int index, const QPointF value);
     int remove(const int index, const int count);
 
     void replace(const int index, const qreal value);
-    void replace(const int index, const QPointF value);
+    void replace(const int index, const qreal *values, const int count);
 
-    qreal pos(const int index);
     qreal value(const int index);
 
 Q_SIGNALS:
@@ -77,7 +75,8 @@ Q_SIGNALS:
 public:
     QBarSet * const q_ptr;
     QString m_label;
-    QList<QPointF> m_values;
+    // The x-coordinate of a value is its index, so only the y-coordinates are stored
+    QVector<qreal> m_values;
     QPen m_pen;
     QBrush m_brush;
     QBrush m_labelBrush;
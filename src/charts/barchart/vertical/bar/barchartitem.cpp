@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/barchartitem_p.h>
-#include <private/bar_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBarSet>
 #include <private/qbarset_p.h>
@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/percentbarchartitem_p.h>
-#include <private/bar_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBarSet>
 #include <private/qbarset_p.h>
@@ -114,7 +113,7 @@ QVector<QRectF> PercentBarChartItem::calculateLayout()
 
 void PercentBarChartItem::handleUpdatedBars()
 {
-    // Handle changes in pen, brush, labels etc.
+    // Pens and brushes are read from the sets when painting, only the labels are cached
     int categoryCount = m_series->d_func()->categoryCount();
     int setCount = m_series->count();
     int itemIndex(0);
@@ -123,19 +122,10 @@ void PercentBarChartItem::handleUpdatedBars()
     for (int category = 0; category < categoryCount; category++) {
         for (int set = 0; set < setCount; set++) {
             QBarSetPrivate *barSet = m_series->d_func()->barsetAt(set)->d_ptr.data();
-            Bar *bar = m_bars.at(itemIndex);
-            bar->setPen(barSet->m_pen);
-            bar->setBrush(barSet->m_brush);
-            bar->update();
-
-            QGraphicsTextItem *label = m_labels.at(itemIndex);
             qreal p = m_series->d_func()->percentageAt(set, category) * 100.0;
-            QString vString(presenter()->numberToString(p, 'f', 0));
             QString valueLabel;
-            if (p == 0) {
-                label->setVisible(false);
-            } else {
-                label->setVisible(m_series->isLabelsVisible());
+            if (p != 0) {
+                QString vString(presenter()->numberToString(p, 'f', 0));
                 if (m_series->labelsFormat().isEmpty()) {
                     vString.append(QStringLiteral("%"));
                     valueLabel = vString;
@@ -144,13 +134,12 @@ void PercentBarChartItem::handleUpdatedBars()
                     valueLabel.replace(valueTag, vString);
                 }
             }
-            label->setHtml(valueLabel);
-            label->setFont(barSet->m_labelFont);
-            label->setDefaultTextColor(barSet->m_labelBrush.color());
-            label->update();
+            setLabel(itemIndex, valueLabel, barSet->m_labelFont);
             itemIndex++;
         }
     }
+    positionLabels();
+    update();
 }
 
 void PercentBarChartItem::handleLabelsPositionChanged()
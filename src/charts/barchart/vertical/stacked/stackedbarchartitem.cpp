@@ -28,7 +28,6 @@
 ****************************************************************************/
 
 #include <private/stackedbarchartitem_p.h>
-#include <private/bar_p.h>
 #include <private/qbarset_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBarSet>
@@ -29,7 +29,6 @@
 
 #include <private/boxplotchartitem_p.h>
 #include <private/qboxplotseries_p.h>
-#include <private/bar_p.h>
 #include <private/qboxset_p.h>
 #include <private/qabstractbarseries_p.h>
 #include <QtCharts/QBoxSet>
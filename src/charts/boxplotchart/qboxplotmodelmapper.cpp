@@ -32,6 +32,7 @@
 #include <QtCharts/QBoxPlotSeries>
 #include <QtCharts/QBoxSet>
 #include <QtCharts/QChart>
+#include <QtCharts/QModelSectionReader>
 #include <QtCore/QAbstractItemModel>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -460,6 +461,30 @@ void QBoxPlotModelMapperPrivate::boxValueChanged(int index)
     initializeBoxFromModel();
 }
 
+// Returns the values of the box-and-whiskers set in the model section.
+QList<qreal> QBoxPlotModelMapperPrivate::boxValuesFromModel(int boxSection)
+{
+    if (QModelSectionReader *reader = qobject_cast<QModelSectionReader *>(m_model)) {
+        const bool vertical = m_orientation == Qt::Vertical;
+        int count = qMax(0, (vertical ? m_model->rowCount() : m_model->columnCount()) - m_first);
+        if (m_count != -1)
+            count = qMin(count, m_count);
+        QVector<qreal> values(count);
+        if (reader->readSection(m_orientation, boxSection, m_first, count, values.data(), 1))
+            return values.toList();
+    }
+
+    QList<qreal> values;
+    int posInBox = 0;
+    QModelIndex boxIndex = boxModelIndex(boxSection, posInBox);
+    while (boxIndex.isValid()) {
+        values.append(m_model->data(boxIndex, Qt::DisplayRole).toDouble());
+        posInBox++;
+        boxIndex = boxModelIndex(boxSection, posInBox);
+    }
+    return values;
+}
+
 void QBoxPlotModelMapperPrivate::initializeBoxFromModel()
 {
     if (m_model == 0 || m_series == 0)
@@ -472,16 +497,10 @@ void QBoxPlotModelMapperPrivate::initializeBoxFromModel()
 
     // create the initial box-and-whiskers sets
     for (int i = m_firstBoxSetSection; i <= m_lastBoxSetSection; i++) {
-        int posInBar = 0;
-        QModelIndex boxIndex = boxModelIndex(i, posInBar);
         // check if there is such model index
-        if (boxIndex.isValid()) {
+        if (boxModelIndex(i, 0).isValid()) {
             QBoxSet *boxSet = new QBoxSet();
-            while (boxIndex.isValid()) {
-                boxSet->append(m_model->data(boxIndex, Qt::DisplayRole).toDouble());
-                posInBar++;
-                boxIndex = boxModelIndex(i, posInBar);
-            }
+            boxSet->append(boxValuesFromModel(i));
             connect(boxSet, SIGNAL(valueChanged(int)), this, SLOT(boxValueChanged(int)));
             m_series->append(boxSet);
             m_boxSets.append(boxSet);
@@ -77,6 +77,7 @@ public Q_SLOTS:
 private:
     QBoxSet *boxSet(QModelIndex index);
     QModelIndex boxModelIndex(int boxSection, int posInBox);
+    QList<qreal> boxValuesFromModel(int boxSection);
     void insertData(int start, int end);
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
@@ -30,6 +30,7 @@
 #include <QtCharts/QCandlestickModelMapper>
 #include <QtCharts/QCandlestickSeries>
 #include <QtCharts/QCandlestickSet>
+#include <QtCharts/QModelSectionReader>
 #include <QtCore/QAbstractItemModel>
 #include <private/qcandlestickmodelmapper_p.h>
 
@@ -395,42 +396,82 @@ void QCandlestickModelMapperPrivate::initializeCandlestickFromModel()
     m_series->clear();
     m_candlestickSets.clear();
 
+    // find the sets that have all of their values in the model
+    int setCount = 0;
+    for (int i = m_firstCandlestickSetSection; i <= m_lastCandlestickSetSection; ++i) {
+        if (!candlestickModelIndex(i, m_timestamp).isValid()
+            || !candlestickModelIndex(i, m_open).isValid()
+            || !candlestickModelIndex(i, m_high).isValid()
+            || !candlestickModelIndex(i, m_low).isValid()
+            || !candlestickModelIndex(i, m_close).isValid()) {
+            break;
+        }
+        ++setCount;
+    }
+
+    QVector<qreal> values;
+    const bool valuesRead = setCount > 0
+            && readCandlestickValues(m_firstCandlestickSetSection, setCount, values);
+
     // create the initial candlestick sets
     QList<QCandlestickSet *> candlestickSets;
-    for (int i = m_firstCandlestickSetSection; i <= m_lastCandlestickSetSection; ++i) {
-        QModelIndex timestampIndex = candlestickModelIndex(i, m_timestamp);
-        QModelIndex openIndex = candlestickModelIndex(i, m_open);
-        QModelIndex highIndex = candlestickModelIndex(i, m_high);
-        QModelIndex lowIndex = candlestickModelIndex(i, m_low);
-        QModelIndex closeIndex = candlestickModelIndex(i, m_close);
-        if (timestampIndex.isValid()
-            && openIndex.isValid()
-            && highIndex.isValid()
-            && lowIndex.isValid()
-            && closeIndex.isValid()) {
-            QCandlestickSet *set = new QCandlestickSet();
-            set->setTimestamp(m_model->data(timestampIndex, Qt::DisplayRole).toReal());
-            set->setOpen(m_model->data(openIndex, Qt::DisplayRole).toReal());
-            set->setHigh(m_model->data(highIndex, Qt::DisplayRole).toReal());
-            set->setLow(m_model->data(lowIndex, Qt::DisplayRole).toReal());
-            set->setClose(m_model->data(closeIndex, Qt::DisplayRole).toReal());
-
-            connect(set, SIGNAL(timestampChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(openChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(highChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(lowChanged()), this, SLOT(candlestickSetChanged()));
-            connect(set, SIGNAL(closeChanged()), this, SLOT(candlestickSetChanged()));
-
-            candlestickSets.append(set);
+    for (int i = m_firstCandlestickSetSection; i < m_firstCandlestickSetSection + setCount; ++i) {
+        QCandlestickSet *set = new QCandlestickSet();
+        if (valuesRead) {
+            const qreal *setValues = values.constData() + (i - m_firstCandlestickSetSection) * 5;
+            set->setTimestamp(setValues[0]);
+            set->setOpen(setValues[1]);
+            set->setHigh(setValues[2]);
+            set->setLow(setValues[3]);
+            set->setClose(setValues[4]);
         } else {
-            break;
+            set->setTimestamp(m_model->data(candlestickModelIndex(i, m_timestamp), Qt::DisplayRole).toReal());
+            set->setOpen(m_model->data(candlestickModelIndex(i, m_open), Qt::DisplayRole).toReal());
+            set->setHigh(m_model->data(candlestickModelIndex(i, m_high), Qt::DisplayRole).toReal());
+            set->setLow(m_model->data(candlestickModelIndex(i, m_low), Qt::DisplayRole).toReal());
+            set->setClose(m_model->data(candlestickModelIndex(i, m_close), Qt::DisplayRole).toReal());
         }
+
+        connect(set, SIGNAL(timestampChanged()), this, SLOT(candlestickSetChanged()));
+        connect(set, SIGNAL(openChanged()), this, SLOT(candlestickSetChanged()));
+        connect(set, SIGNAL(highChanged()), this, SLOT(candlestickSetChanged()));
+        connect(set, SIGNAL(lowChanged()), this, SLOT(candlestickSetChanged()));
+        connect(set, SIGNAL(closeChanged()), this, SLOT(candlestickSetChanged()));
+
+        candlestickSets.append(set);
     }
     m_series->append(candlestickSets);
     m_candlestickSets.append(candlestickSets);
     blockSeriesSignals(false);
 }
 
+// Reads the values of count candlestick sets starting from the model section firstSection with the
+// section reader of the model. The values of each set are stored in the order timestamp, open,
+// high, low and close. Returns false if the model does not implement the reader or declines to
+// read the values.
+bool QCandlestickModelMapperPrivate::readCandlestickValues(int firstSection, int count,
+                                                           QVector<qreal> &values)
+{
+    Q_Q(QCandlestickModelMapper);
+
+    QModelSectionReader *reader = qobject_cast<QModelSectionReader *>(m_model);
+    if (!reader)
+        return false;
+
+    // The values of one kind are in the same position of each set, i.e. across the sections
+    const Qt::Orientation orientation = (q->orientation() == Qt::Vertical) ? Qt::Horizontal
+                                                                          : Qt::Vertical;
+    const int positions[] = { m_timestamp, m_open, m_high, m_low, m_close };
+    values.resize(count * 5);
+    for (int i = 0; i < 5; ++i) {
+        if (!reader->readSection(orientation, positions[i], firstSection, count,
+                                 values.data() + i, 5)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void QCandlestickModelMapperPrivate::modelDataUpdated(QModelIndex topLeft, QModelIndex bottomRight)
 {
     Q_Q(QCandlestickModelMapper);
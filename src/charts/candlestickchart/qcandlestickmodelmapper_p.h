@@ -41,6 +41,7 @@
 
 #include <QtCharts/QCandlestickModelMapper>
 #include <QtCore/QObject>
+#include <QtCore/QVector>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
@@ -87,6 +88,7 @@ private Q_SLOTS:
 private:
     QCandlestickSet *candlestickSet(QModelIndex index);
     QModelIndex candlestickModelIndex(int section, int pos);
+    bool readCandlestickValues(int firstSection, int count, QVector<qreal> &values);
     void insertData(int start, int end);
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
@@ -61,4 +61,15 @@ static inline bool isValidValue(const QPointF point)
     return (isValidValue(point.x()) && isValidValue(point.y()));
 }
 
+// Comparisons for binary searches of x values in points sorted by x
+static inline bool pointXLessThan(const QPointF &point, qreal x)
+{
+    return point.x() < x;
+}
+
+static inline bool xLessThanPoint(qreal x, const QPointF &point)
+{
+    return x < point.x();
+}
+
 #endif // CHARTHELPERS_P_H
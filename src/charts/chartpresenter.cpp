@@ -54,6 +54,8 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       m_options(QChart::NoAnimation),
       m_animationDuration(ChartAnimationDuration),
       m_animationCurve(QEasingCurve::OutQuart),
+      m_animationSuppressionInterval(0),
+      m_animationPointLimit(0),
       m_state(ShowState),
       m_background(0),
       m_plotAreaBackground(0),
@@ -208,6 +210,16 @@ QChart::AnimationOptions ChartPresenter::animationOptions() const
     return m_options;
 }
 
+void ChartPresenter::setAnimationSuppressionInterval(int msecs)
+{
+    m_animationSuppressionInterval = qMax(0, msecs);
+}
+
+void ChartPresenter::setAnimationPointLimit(int count)
+{
+    m_animationPointLimit = qMax(0, count);
+}
+
 void ChartPresenter::createBackgroundItem()
 {
     if (!m_background) {
@@ -245,7 +257,22 @@ void ChartPresenter::createTitleItem()
 void ChartPresenter::startAnimation(ChartAnimation *animation)
 {
     animation->stop();
-    QTimer::singleShot(0, animation, SLOT(startChartAnimation()));
+    animation->queueStart();
+}
+
+// Returns true if a data change of pointCount points should be shown without the animation.
+// Changes of series with more points than the point limit are not animated, nor are changes
+// that follow the previous change of the same series within the suppression interval, so a
+// series that is updated continuously is not animated until its updates pause.
+bool ChartPresenter::isAnimationSuppressed(ChartAnimation *animation, int pointCount)
+{
+    bool suppressed = m_animationPointLimit > 0 && pointCount > m_animationPointLimit;
+    if (m_animationSuppressionInterval > 0) {
+        const qint64 interval = animation->updateInterval();
+        if (interval >= 0 && interval < m_animationSuppressionInterval)
+            suppressed = true;
+    }
+    return suppressed;
 }
 
 void ChartPresenter::setBackgroundBrush(const QBrush &brush)
@@ -157,7 +157,13 @@ public:
     void setAnimationEasingCurve(const QEasingCurve &curve);
     QEasingCurve animationEasingCurve() const { return m_animationCurve; }
 
+    void setAnimationSuppressionInterval(int msecs);
+    int animationSuppressionInterval() const { return m_animationSuppressionInterval; }
+    void setAnimationPointLimit(int count);
+    int animationPointLimit() const { return m_animationPointLimit; }
+
     void startAnimation(ChartAnimation *animation);
+    bool isAnimationSuppressed(ChartAnimation *animation, int pointCount);
 
     void setState(State state,QPointF point);
     State state() const { return m_state; }
@@ -201,6 +207,8 @@ private:
     QChart::AnimationOptions m_options;
     int m_animationDuration;
     QEasingCurve m_animationCurve;
+    int m_animationSuppressionInterval;
+    int m_animationPointLimit;
     State m_state;
     QPointF m_statePoint;
     AbstractChartLayout *m_layout;
@@ -33,7 +33,8 @@ SOURCES += \
     $$PWD/chartitem.cpp \
     $$PWD/scroller.cpp \
     $$PWD/charttitle.cpp \
-    $$PWD/qpolarchart.cpp
+    $$PWD/qpolarchart.cpp \
+    $$PWD/qmodelsectionreader.cpp
 
 contains(QT_CONFIG, opengl): SOURCES += $$PWD/glwidget.cpp
 
@@ -60,7 +61,8 @@ PUBLIC_HEADERS += \
     $$PWD/qabstractseries.h \
     $$PWD/qchartview.h \
     $$PWD/chartsnamespace.h \
-    $$PWD/qpolarchart.h
+    $$PWD/qpolarchart.h \
+    $$PWD/qmodelsectionreader.h
 
 include($$PWD/common.pri)
 include($$PWD/animations/animations.pri)
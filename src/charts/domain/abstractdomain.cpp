@@ -31,6 +31,11 @@
 #include <private/qabstractaxis_p.h>
 #include <QtCore/QtMath>
 #include <cmath>
+#include <algorithm>
+
+#if defined(__SSE2__) && !defined(QT_COORD_TYPE)
+#include <emmintrin.h>
+#endif
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -269,6 +274,69 @@ void AbstractDomain::adjustLogDomainRanges(qreal &min, qreal &max)
     }
 }
 
+static void transformLinearPoints(const QPointF *points, int count, QPointF *result,
+                                  qreal originX, qreal scaleX, qreal offsetX,
+                                  qreal originY, qreal scaleY, qreal offsetY)
+{
+    int i = 0;
+#if defined(__SSE2__) && !defined(QT_COORD_TYPE)
+    // QPointF stores x and y next to each other, so one register transforms a whole point.
+    const __m128d origin = _mm_set_pd(originY, originX);
+    const __m128d scale = _mm_set_pd(scaleY, scaleX);
+    const __m128d offset = _mm_set_pd(offsetY, offsetX);
+    const double *source = reinterpret_cast<const double *>(points);
+    double *target = reinterpret_cast<double *>(result);
+    for (; i < count; ++i) {
+        __m128d point = _mm_loadu_pd(source + 2 * i);
+        point = _mm_add_pd(_mm_mul_pd(_mm_sub_pd(point, origin), scale), offset);
+        _mm_storeu_pd(target + 2 * i, point);
+    }
+#endif
+    for (; i < count; ++i) {
+        result[i].setX((points[i].x() - originX) * scaleX + offsetX);
+        result[i].setY((points[i].y() - originY) * scaleY + offsetY);
+    }
+}
+
+static inline qreal transformCoordinate(qreal value, bool logarithmic, qreal origin, qreal scale,
+                                        qreal offset, qreal invalid, bool &ok)
+{
+    if (!logarithmic)
+        return (value - origin) * scale + offset;
+    if (value > 0)
+        return (std::log10(value) - origin) * scale + offset;
+    ok = false;
+    return invalid;
+}
+
+// Transforms count points to geometry coordinates in result, which must have room for count
+// points. Points that can not be transformed do not stop the transformation, they are marked
+// in valid, if given, and their count is returned.
+int AbstractDomain::transformPoints(const QPointF *points, int count, QPointF *result, bool *valid,
+                                    const AxisTransform &x, const AxisTransform &y)
+{
+    if (!x.logarithmic && !y.logarithmic) {
+        transformLinearPoints(points, count, result, x.origin, x.scale, x.offset,
+                              y.origin, y.scale, y.offset);
+        if (valid)
+            std::fill(valid, valid + count, true);
+        return 0;
+    }
+
+    int invalidCount = 0;
+    for (int i = 0; i < count; ++i) {
+        bool ok = true;
+        result[i].setX(transformCoordinate(points[i].x(), x.logarithmic, x.origin, x.scale,
+                                           x.offset, x.invalid, ok));
+        result[i].setY(transformCoordinate(points[i].y(), y.logarithmic, y.origin, y.scale,
+                                           y.offset, y.invalid, ok));
+        if (!ok)
+            invalidCount++;
+        if (valid)
+            valid[i] = ok;
+    }
+    return invalidCount;
+}
 
 #include "moc_abstractdomain_p.cpp"
 
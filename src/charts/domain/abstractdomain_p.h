@@ -104,6 +104,8 @@ public:
     virtual QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const = 0;
     virtual QPointF calculateDomainPoint(const QPointF &point) const = 0;
     virtual QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const = 0;
+    virtual int calculateGeometryPoints(const QPointF *points, int count, QPointF *result,
+                                        bool *valid = 0) const = 0;
 
     virtual bool attachAxis(QAbstractAxis *axis);
     virtual bool detachAxis(QAbstractAxis *axis);
@@ -121,7 +123,24 @@ public Q_SLOTS:
     void handleHorizontalAxisRangeChanged(qreal min,qreal max);
 
 protected:
+    // Maps a coordinate v to (f(v) - origin) * scale + offset, where f is either the identity
+    // or log10. Coordinates that have no logarithm are mapped to invalid.
+    struct AxisTransform
+    {
+        AxisTransform(qreal origin, qreal scale, qreal offset, bool logarithmic = false,
+                      qreal invalid = 0)
+            : origin(origin), scale(scale), offset(offset), invalid(invalid),
+              logarithmic(logarithmic) {}
+        qreal origin;
+        qreal scale;
+        qreal offset;
+        qreal invalid;
+        bool logarithmic;
+    };
+
     void adjustLogDomainRanges(qreal &min, qreal &max);
+    static int transformPoints(const QPointF *points, int count, QPointF *result, bool *valid,
+                               const AxisTransform &x, const AxisTransform &y);
 
     qreal m_minX;
     qreal m_maxX;
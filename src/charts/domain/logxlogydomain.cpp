@@ -175,26 +175,29 @@ QPointF LogXLogYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) c
 
 QVector<QPointF> LogXLogYDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
 {
-    const qreal deltaX = m_size.width() / qAbs(m_logRightX - m_logLeftX);
-    const qreal deltaY = m_size.height() / qAbs(m_logRightY - m_logLeftY);
-
     QVector<QPointF> result;
     result.resize(vector.count());
-
-    for (int i = 0; i < vector.count(); ++i) {
-        if (vector[i].x() > 0 && vector[i].y() > 0) {
-            qreal x = (std::log10(vector[i].x()) / std::log10(m_logBaseX)) * deltaX - m_logLeftX * deltaX;
-            qreal y = (std::log10(vector[i].y()) / std::log10(m_logBaseY)) * -deltaY - m_logLeftY * -deltaY + m_size.height();
-            result[i].setX(x);
-            result[i].setY(y);
-        } else {
-            qWarning() << "Logarithms of zero and negative values are undefined.";
-            return QVector<QPointF>();
-        }
+    if (calculateGeometryPoints(vector.constData(), vector.count(), result.data()) > 0) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
     }
     return result;
 }
 
+int LogXLogYDomain::calculateGeometryPoints(const QPointF *points, int count, QPointF *result,
+                                            bool *valid) const
+{
+    const qreal deltaX = m_size.width() / qAbs(m_logRightX - m_logLeftX);
+    const qreal deltaY = m_size.height() / qAbs(m_logRightY - m_logLeftY);
+    const qreal logBaseX = std::log10(m_logBaseX);
+    const qreal logBaseY = std::log10(m_logBaseY);
+
+    return transformPoints(points, count, result, valid,
+                           AxisTransform(m_logLeftX * logBaseX, deltaX / logBaseX, 0, true, 0),
+                           AxisTransform(m_logLeftY * logBaseY, -deltaY / logBaseY,
+                                         m_size.height(), true, m_size.height()));
+}
+
 QPointF LogXLogYDomain::calculateDomainPoint(const QPointF &point) const
 {
     const qreal deltaX = m_size.width() / qAbs(m_logRightX - m_logLeftX);
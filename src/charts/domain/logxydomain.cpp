@@ -159,27 +159,27 @@ QPointF LogXYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) cons
 
 QVector<QPointF> LogXYDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
 {
-    const qreal deltaX = m_size.width() / (m_logRightX - m_logLeftX);
-    const qreal deltaY = m_size.height() / (m_maxY - m_minY);
-
     QVector<QPointF> result;
     result.resize(vector.count());
-
-    for (int i = 0; i < vector.count(); ++i) {
-        if (vector[i].x() > 0) {
-            qreal x = (std::log10(vector[i].x()) / std::log10(m_logBaseX)) * deltaX - m_logLeftX * deltaX;
-            qreal y = (vector[i].y() - m_minY) * -deltaY + m_size.height();
-            result[i].setX(x);
-            result[i].setY(y);
-        } else {
-            qWarning() << "Logarithms of zero and negative values are undefined.";
-            return QVector<QPointF>();
-        }
-
+    if (calculateGeometryPoints(vector.constData(), vector.count(), result.data()) > 0) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
     }
     return result;
 }
 
+int LogXYDomain::calculateGeometryPoints(const QPointF *points, int count, QPointF *result,
+                                         bool *valid) const
+{
+    const qreal deltaX = m_size.width() / (m_logRightX - m_logLeftX);
+    const qreal deltaY = m_size.height() / (m_maxY - m_minY);
+    const qreal logBaseX = std::log10(m_logBaseX);
+
+    return transformPoints(points, count, result, valid,
+                           AxisTransform(m_logLeftX * logBaseX, deltaX / logBaseX, 0, true, 0),
+                           AxisTransform(m_minY, -deltaY, m_size.height()));
+}
+
 QPointF LogXYDomain::calculateDomainPoint(const QPointF &point) const
 {
     const qreal deltaX = m_size.width() / (m_logRightX - m_logLeftX);
@@ -68,23 +68,36 @@ QVector<QPointF> PolarDomain::calculateGeometryPoints(const QVector<QPointF> &ve
 {
     QVector<QPointF> result;
     result.resize(vector.count());
+    if (calculateGeometryPoints(vector.constData(), vector.count(), result.data()) > 0) {
+        qWarning() << "Logarithm of negative value is undefined. Empty layout returned.";
+        return QVector<QPointF>();
+    }
+    return result;
+}
+
+int PolarDomain::calculateGeometryPoints(const QPointF *points, int count, QPointF *result,
+                                         bool *valid) const
+{
+    int invalidCount = 0;
     bool ok;
     qreal r = 0.0;
     qreal a = 0.0;
 
-    for (int i = 0; i < vector.count(); ++i) {
-        a = toAngularCoordinate(vector[i].x(), ok);
+    for (int i = 0; i < count; ++i) {
+        a = toAngularCoordinate(points[i].x(), ok);
         if (ok)
-            r = toRadialCoordinate(vector[i].y(), ok);
+            r = toRadialCoordinate(points[i].y(), ok);
         if (ok) {
             result[i] = m_center + polarCoordinateToPoint(a, r);
         } else {
-            qWarning() << "Logarithm of negative value is undefined. Empty layout returned.";
-            return QVector<QPointF>();
+            result[i] = QPointF();
+            invalidCount++;
         }
+        if (valid)
+            valid[i] = ok;
     }
 
-    return result;
+    return invalidCount;
 }
 
 QPointF PolarDomain::polarCoordinateToPoint(qreal angularCoordinate, qreal radialCoordinate) const
@@ -55,6 +55,8 @@ public:
 
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const;
     QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const;
+    int calculateGeometryPoints(const QPointF *points, int count, QPointF *result,
+                                bool *valid = 0) const;
 
     virtual qreal toAngularCoordinate(qreal value, bool &ok) const = 0;
     virtual qreal toRadialCoordinate(qreal value, bool &ok) const = 0;
@@ -157,21 +157,23 @@ QPointF XYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) const
 
 QVector<QPointF> XYDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
 {
-    const qreal deltaX = m_size.width() / (m_maxX - m_minX);
-    const qreal deltaY = m_size.height() / (m_maxY - m_minY);
-
     QVector<QPointF> result;
     result.resize(vector.count());
-
-    for (int i = 0; i < vector.count(); ++i) {
-        qreal x = (vector[i].x() - m_minX) * deltaX;
-        qreal y = (vector[i].y() - m_minY) * -deltaY + m_size.height();
-        result[i].setX(x);
-        result[i].setY(y);
-    }
+    calculateGeometryPoints(vector.constData(), vector.count(), result.data());
     return result;
 }
 
+int XYDomain::calculateGeometryPoints(const QPointF *points, int count, QPointF *result,
+                                      bool *valid) const
+{
+    const qreal deltaX = m_size.width() / (m_maxX - m_minX);
+    const qreal deltaY = m_size.height() / (m_maxY - m_minY);
+
+    return transformPoints(points, count, result, valid,
+                           AxisTransform(m_minX, deltaX, 0),
+                           AxisTransform(m_minY, -deltaY, m_size.height()));
+}
+
 QPointF XYDomain::calculateDomainPoint(const QPointF &point) const
 {
     const qreal deltaX = m_size.width() / (m_maxX - m_minX);
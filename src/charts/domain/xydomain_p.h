@@ -66,6 +66,8 @@ public:
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const;
     QPointF calculateDomainPoint(const QPointF &point) const;
     QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const;
+    int calculateGeometryPoints(const QPointF *points, int count, QPointF *result,
+                                bool *valid = 0) const;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -50,6 +50,7 @@ GLWidget::GLWidget(GLXYSeriesDataManager *xyDataManager, QWidget *parent)
       m_minUniformLoc(-1),
       m_deltaUniformLoc(-1),
       m_pointSizeUniformLoc(-1),
+      m_logFactorUniformLoc(-1),
       m_xyDataManager(xyDataManager)
 {
     setAttribute(Qt::WA_TranslucentBackground);
@@ -110,8 +111,14 @@ static const char *vertexSource =
         "uniform highp vec2 delta;\n"
         "uniform highp float pointSize;\n"
         "uniform highp mat4 matrix;\n"
+        "uniform highp vec2 logFactor;\n"
         "void main() {\n"
-        "  vec2 normalPoint = vec2(-1, -1) + ((points - min) / delta);\n"
+        "  highp vec2 value = points;\n"
+        "  if (logFactor.x > 0.0)\n"
+        "    value.x = log(points.x) * logFactor.x;\n"
+        "  if (logFactor.y > 0.0)\n"
+        "    value.y = log(points.y) * logFactor.y;\n"
+        "  vec2 normalPoint = vec2(-1, -1) + ((value - min) / delta);\n"
         "  gl_Position = matrix * vec4(normalPoint, 0, 1);\n"
         "  gl_PointSize = pointSize;\n"
         "}";
@@ -140,6 +147,7 @@ void GLWidget::initializeGL()
     m_deltaUniformLoc = m_program->uniformLocation("delta");
     m_pointSizeUniformLoc = m_program->uniformLocation("pointSize");
     m_matrixUniformLoc = m_program->uniformLocation("matrix");
+    m_logFactorUniformLoc = m_program->uniformLocation("logFactor");
 
 
     // Create a vertex array object. In OpenGL ES 2.0 and OpenGL 2.x
@@ -182,6 +190,7 @@ void GLWidget::paintGL()
         m_program->setUniformValue(m_minUniformLoc, data->min);
         m_program->setUniformValue(m_deltaUniformLoc, data->delta);
         m_program->setUniformValue(m_matrixUniformLoc, data->matrix);
+        m_program->setUniformValue(m_logFactorUniformLoc, data->logFactor);
 
         if (!vbo) {
             vbo = new QOpenGLBuffer;
@@ -190,17 +199,30 @@ void GLWidget::paintGL()
         }
         vbo->bind();
         if (data->dirty) {
-            vbo->allocate(data->array.constData(), data->array.count() * sizeof(GLfloat));
-            data->dirty = false;
+            const int size = data->array.count() * sizeof(GLfloat);
+            if (size > vbo->size()) {
+                // Grow the buffer geometrically, so that streamed points rarely reallocate it
+                vbo->allocate(qMax(size, vbo->size() * 2));
+                vbo->write(0, data->array.constData(), size);
+            } else if (data->changedFrom < data->changedTo) {
+                // Upload only the changed values
+                const int changedTo = qMin(data->changedTo, data->array.count());
+                if (data->changedFrom < changedTo) {
+                    vbo->write(data->changedFrom * sizeof(GLfloat),
+                               data->array.constData() + data->changedFrom,
+                               (changedTo - data->changedFrom) * sizeof(GLfloat));
+                }
+            }
+            data->clearChanged();
         }
 
         glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
         if (data->type == QAbstractSeries::SeriesTypeLine) {
             glLineWidth(data->width);
-            glDrawArrays(GL_LINE_STRIP, 0, data->array.size() / 2);
+            glDrawArrays(GL_LINE_STRIP, data->offset / 2, data->pointCount());
         } else { // Scatter
             m_program->setUniformValue(m_pointSizeUniformLoc, data->width);
-            glDrawArrays(GL_POINTS, 0, data->array.size() / 2);
+            glDrawArrays(GL_POINTS, data->offset / 2, data->pointCount());
         }
         vbo->release();
     }
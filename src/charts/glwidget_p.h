@@ -80,6 +80,7 @@ private:
     int m_deltaUniformLoc;
     int m_pointSizeUniformLoc;
     int m_matrixUniformLoc;
+    int m_logFactorUniformLoc;
     QOpenGLVertexArrayObject m_vao;
 
     QHash<const QAbstractSeries *, QOpenGLBuffer *> m_seriesBufferMap;
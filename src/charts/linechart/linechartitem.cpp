@@ -34,6 +34,7 @@
 #include <private/polardomain_p.h>
 #include <private/chartthememanager_p.h>
 #include <private/charttheme_p.h>
+#include <private/xygeometrytask_p.h>
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
@@ -44,6 +45,8 @@ const qreal mouseEventMinWidth(12);
 LineChartItem::LineChartItem(QLineSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
+      m_shapeDirty(false),
+      m_shapePointCount(0),
       m_pointsVisible(false),
       m_chartType(QChart::ChartTypeUndefined),
       m_pointLabelsVisible(false),
@@ -76,12 +79,34 @@ QRectF LineChartItem::boundingRect() const
 
 QPainterPath LineChartItem::shape() const
 {
+    // Stroking the path is expensive, so the shape is created only when it is needed for
+    // detecting hovers and clicks.
+    if (m_shapeDirty || m_shapePointCount == 0) {
+        m_shapePath = createShapePath(m_fullPath);
+        m_shapeDirty = false;
+        m_shapePointCount = m_linePoints.size();
+    } else if (m_shapePointCount < m_linePoints.size()) {
+        // Points have been appended to the line since the shape was created
+        QPainterPath segmentPath;
+        segmentPath.moveTo(m_linePoints.at(m_shapePointCount - 1));
+        int size = m_linePen.width();
+        for (int i = m_shapePointCount; i < m_linePoints.size(); i++) {
+            segmentPath.lineTo(m_linePoints.at(i));
+            if (m_pointsVisible) {
+                segmentPath.addEllipse(m_linePoints.at(i), size, size);
+                segmentPath.moveTo(m_linePoints.at(i));
+            }
+        }
+        m_shapePath.addPath(createShapePath(segmentPath));
+        m_shapePointCount = m_linePoints.size();
+    }
     return m_shapePath;
 }
 
 void LineChartItem::updateGeometry()
 {
     if (m_series->useOpenGL()) {
+        discardGeometryTask();
         if (!m_rect.isEmpty()) {
             prepareGeometryChange();
             // Changed signal seems to trigger even with empty region
@@ -91,12 +116,34 @@ void LineChartItem::updateGeometry()
         return;
     }
 
+    // Area series use component line series that aren't necessarily added to the chart themselves,
+    // so check if chart type is forced before trying to obtain it from the chart.
+    QChart::ChartType chartType = m_chartType;
+    if (chartType == QChart::ChartTypeUndefined)
+        chartType = m_series->chart()->chartType();
+
+    if (chartType != QChart::ChartTypePolar && m_series->asynchronousGeometry()
+            && !m_points.isEmpty()
+            && !(m_animation && m_animation->state() == QAbstractAnimation::Running)) {
+        if (XYGeometryTask *task = createGeometryTask()) {
+            task->decimate = task->decimate && !m_pointsVisible && !m_pointLabelsVisible;
+            task->markerSize = m_pointsVisible ? m_linePen.width() : 0;
+            task->strokeWidth = m_linePen.width() * 1.42;
+            task->miterLimit = m_linePen.miterLimit();
+            startGeometryTask(task);
+        }
+        return;
+    }
+    discardGeometryTask();
+
     // Store the points to a local variable so that the old line gets properly cleared
     // when animation starts.
     m_linePoints = geometryPoints();
-    const QVector<QPointF> &points = m_linePoints;
+    // The shape is extended from m_linePoints when points have been appended, so it has to be
+    // recreated whenever the points are replaced, even if the paths are kept below.
+    m_shapeDirty = true;
 
-    if (points.size() == 0) {
+    if (m_linePoints.size() == 0) {
         prepareGeometryChange();
         m_fullPath = QPainterPath();
         m_linePath = QPainterPath();
@@ -104,17 +151,17 @@ void LineChartItem::updateGeometry()
         return;
     }
 
+    // Visible points and point labels need every point, so the line is only decimated when
+    // neither is shown.
+    if (chartType != QChart::ChartTypePolar && !m_pointsVisible && !m_pointLabelsVisible)
+        m_linePoints = decimateGeometryPoints(m_linePoints);
+    const QVector<QPointF> &points = m_linePoints;
+
     QPainterPath linePath;
     QPainterPath fullPath;
     // Use worst case scenario to determine required margin.
     qreal margin = m_linePen.width() * 1.42;
 
-    // Area series use component line series that aren't necessarily added to the chart themselves,
-    // so check if chart type is forced before trying to obtain it from the chart.
-    QChart::ChartType chartType = m_chartType;
-    if (chartType == QChart::ChartTypeUndefined)
-        chartType = m_series->chart()->chartType();
-
     // For polar charts, we need special handling for angular (horizontal)
     // points that are off-grid.
     if (chartType == QChart::ChartTypePolar) {
@@ -309,44 +356,134 @@ void LineChartItem::updateGeometry()
         fullPath = linePath;
     }
 
-    QPainterPathStroker stroker;
-    // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
-    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
-    // multiply line width with square root of two when defining shape and bounding rectangle.
-    stroker.setWidth(margin);
-    stroker.setJoinStyle(Qt::MiterJoin);
-    stroker.setCapStyle(Qt::SquareCap);
-    stroker.setMiterLimit(m_linePen.miterLimit());
-
-    QPainterPath checkShapePath = stroker.createStroke(fullPath);
+    // The line path is a part of the full path, so the bounding rect of the shape covers both.
+    QRectF rect = shapeRect(fullPath);
 
     // Only zoom in if the bounding rects of the paths fit inside int limits. QWidget::update() uses
     // a region that has to be compatible with QRect.
-    if (checkShapePath.boundingRect().height() <= INT_MAX
-            && checkShapePath.boundingRect().width() <= INT_MAX
-            && linePath.boundingRect().height() <= INT_MAX
-            && linePath.boundingRect().width() <= INT_MAX
-            && fullPath.boundingRect().height() <= INT_MAX
-            && fullPath.boundingRect().width() <= INT_MAX) {
+    if (rect.height() <= INT_MAX && rect.width() <= INT_MAX) {
         prepareGeometryChange();
 
         m_linePath = linePath;
         m_fullPath = fullPath;
-        m_shapePath = checkShapePath;
+        m_shapePath = QPainterPath();
 
-        m_rect = m_shapePath.boundingRect();
+        m_rect = rect;
     } else {
         update();
     }
 }
 
+void LineChartItem::appendGeometry(const QVector<QPointF> &points)
+{
+    // Area series use component line series that aren't necessarily added to the chart themselves,
+    // so check if chart type is forced before trying to obtain it from the chart.
+    QChart::ChartType chartType = m_chartType;
+    if (chartType == QChart::ChartTypeUndefined)
+        chartType = m_series->chart()->chartType();
+
+    // Polar charts need the off-grid handling of the full update, and decimated lines need
+    // to be reduced again.
+    if (m_series->useOpenGL() || chartType == QChart::ChartTypePolar
+            || m_series->decimationMode() != QXYSeries::DecimationNone
+            || geometryTaskRunning()
+            || m_linePoints.isEmpty() || m_linePoints.size() != m_points.size()) {
+        XYChart::appendGeometry(points);
+        return;
+    }
+
+    QPainterPath segmentPath;
+    segmentPath.moveTo(m_linePoints.last());
+    int size = m_linePen.width();
+    for (int i = 0; i < points.size(); i++) {
+        segmentPath.lineTo(points.at(i));
+        if (m_pointsVisible) {
+            segmentPath.addEllipse(points.at(i), size, size);
+            segmentPath.moveTo(points.at(i));
+        }
+    }
+
+    QRectF rect = m_rect.united(shapeRect(segmentPath));
+
+    // Only zoom in if the bounding rect of the path fits inside int limits. QWidget::update() uses
+    // a region that has to be compatible with QRect.
+    if (rect.height() > INT_MAX || rect.width() > INT_MAX) {
+        XYChart::appendGeometry(points);
+        return;
+    }
+
+    // Drop the shared copies first, so that extending the points and the path does not
+    // detach them and copy the whole series.
+    m_linePoints = QVector<QPointF>();
+    m_fullPath = QPainterPath();
+
+    m_points += points;
+    for (int i = 0; i < points.size(); i++) {
+        m_linePath.lineTo(points.at(i));
+        if (m_pointsVisible) {
+            m_linePath.addEllipse(points.at(i), size, size);
+            m_linePath.moveTo(points.at(i));
+        }
+    }
+    m_linePoints = m_points;
+    m_fullPath = m_linePath;
+
+    if (rect != m_rect) {
+        prepareGeometryChange();
+        m_rect = rect;
+    }
+    update();
+}
+
+void LineChartItem::applyGeometryTask(const XYGeometryTask *task)
+{
+    // Only zoom in if the bounding rects of the paths fit inside int limits. QWidget::update() uses
+    // a region that has to be compatible with QRect.
+    if (task->valid) {
+        prepareGeometryChange();
+        m_linePoints = task->points;
+        m_linePath = task->path;
+        m_fullPath = task->path;
+        m_shapePath = task->shapePath;
+        m_shapeDirty = false;
+        m_shapePointCount = m_linePoints.size();
+        m_rect = task->rect;
+    }
+    update();
+}
+
+QRectF LineChartItem::shapeRect(const QPainterPath &path) const
+{
+    // Covers the stroke of createShapePath(), including the miter of sharp corners, without
+    // creating it.
+    const qreal margin = m_linePen.width() * 1.42 / 2 * qMax(qreal(1), m_linePen.miterLimit());
+    return path.boundingRect().adjusted(-margin, -margin, margin, margin);
+}
+
+QPainterPath LineChartItem::createShapePath(const QPainterPath &path) const
+{
+    QPainterPathStroker stroker;
+    // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
+    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
+    // multiply line width with square root of two when defining shape and bounding rectangle.
+    stroker.setWidth(m_linePen.width() * 1.42);
+    stroker.setJoinStyle(Qt::MiterJoin);
+    stroker.setCapStyle(Qt::SquareCap);
+    stroker.setMiterLimit(m_linePen.miterLimit());
+
+    return stroker.createStroke(path);
+}
+
 void LineChartItem::handleUpdated()
 {
     // If points visibility has changed, a geometry update is needed.
     // Also, if pen changes when points are visible, geometry update is needed.
+    // Point labels visibility decides whether a decimated line can be used.
     bool doGeometryUpdate =
         (m_pointsVisible != m_series->pointsVisible())
-        || (m_series->pointsVisible() && (m_linePen != m_series->pen()));
+        || (m_series->pointsVisible() && (m_linePen != m_series->pen()))
+        || (m_series->decimationMode() != QXYSeries::DecimationNone
+            && m_pointLabelsVisible != m_series->pointLabelsVisible());
     setVisible(m_series->isVisible());
     setOpacity(m_series->opacity());
     m_pointsVisible = m_series->pointsVisible();
@@ -416,7 +553,8 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
             painter->setClipping(true);
         else
             painter->setClipping(false);
-        m_series->d_func()->drawSeriesPointLabels(painter, m_linePoints, m_linePen.width() / 2);
+        m_series->d_func()->drawSeriesPointLabels(painter, m_linePoints, m_linePen.width() / 2,
+                                                  m_firstPoint);
     }
 
     painter->restore();
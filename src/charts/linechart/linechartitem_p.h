@@ -69,6 +69,8 @@ public Q_SLOTS:
 
 protected:
     void updateGeometry();
+    void appendGeometry(const QVector<QPointF> &points);
+    void applyGeometryTask(const XYGeometryTask *task);
     void mousePressEvent(QGraphicsSceneMouseEvent *event);
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
     void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
@@ -78,12 +80,19 @@ protected:
     void forceChartType(QChart::ChartType chartType) { m_chartType = chartType; }
 
 private:
+    QPainterPath createShapePath(const QPainterPath &path) const;
+    QRectF shapeRect(const QPainterPath &path) const;
+
     QLineSeries *m_series;
     QPainterPath m_linePath;
     QPainterPath m_linePathPolarRight;
     QPainterPath m_linePathPolarLeft;
     QPainterPath m_fullPath;
-    QPainterPath m_shapePath;
+    // Created from the full path on demand by shape()
+    mutable QPainterPath m_shapePath;
+    mutable bool m_shapeDirty;
+    // Number of line points covered by the shape, to extend it after points are appended
+    mutable int m_shapePointCount;
 
     QVector<QPointF> m_linePoints;
     QRectF m_rect;
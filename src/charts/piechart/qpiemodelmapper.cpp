@@ -31,6 +31,7 @@
 #include <private/qpiemodelmapper_p.h>
 #include <QtCharts/QPieSeries>
 #include <QtCharts/QPieSlice>
+#include <QtCharts/QModelSectionReader>
 #include <QtCore/QAbstractItemModel>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -543,6 +544,28 @@ void QPieModelMapperPrivate::removeData(int start, int end)
     }
 }
 
+// Returns the values of the slices read with the section reader of the model, or an empty vector
+// if the model does not implement it.
+QVector<qreal> QPieModelMapperPrivate::sliceValuesFromModel()
+{
+    QModelSectionReader *reader = qobject_cast<QModelSectionReader *>(m_model);
+    if (!reader)
+        return QVector<qreal>();
+
+    const bool vertical = m_orientation == Qt::Vertical;
+    const int sectionCount = vertical ? m_model->columnCount() : m_model->rowCount();
+    if (m_valuesSection < 0 || m_valuesSection >= sectionCount)
+        return QVector<qreal>();
+    int count = qMax(0, (vertical ? m_model->rowCount() : m_model->columnCount()) - m_first);
+    if (m_count != -1)
+        count = qMin(count, m_count);
+
+    QVector<qreal> values(count);
+    if (!reader->readSection(m_orientation, m_valuesSection, m_first, count, values.data(), 1))
+        values.clear();
+    return values;
+}
+
 void QPieModelMapperPrivate::initializePieFromModel()
 {
     if (m_model == 0 || m_series == 0)
@@ -554,13 +577,17 @@ void QPieModelMapperPrivate::initializePieFromModel()
     m_slices.clear();
 
     // create the initial slices set
+    const QVector<qreal> values = sliceValuesFromModel();
     int slicePos = 0;
     QModelIndex valueIndex = valueModelIndex(slicePos);
     QModelIndex labelIndex = labelModelIndex(slicePos);
     while (valueIndex.isValid() && labelIndex.isValid()) {
         QPieSlice *slice = new QPieSlice;
         slice->setLabel(m_model->data(labelIndex, Qt::DisplayRole).toString());
-        slice->setValue(m_model->data(valueIndex, Qt::DisplayRole).toDouble());
+        if (slicePos < values.count())
+            slice->setValue(values.at(slicePos));
+        else
+            slice->setValue(m_model->data(valueIndex, Qt::DisplayRole).toDouble());
         connect(slice, SIGNAL(labelChanged()), this, SLOT(sliceLabelChanged()));
         connect(slice, SIGNAL(valueChanged()), this, SLOT(sliceValueChanged()));
         m_series->append(slice);
@@ -40,6 +40,7 @@
 #define QPIEMODELMAPPER_P_H
 
 #include <QtCore/QObject>
+#include <QtCore/QVector>
 #include <QtCharts/QPieModelMapper>
 
 QT_BEGIN_NAMESPACE
@@ -81,6 +82,7 @@ private:
     bool isValueIndex(QModelIndex index) const;
     QModelIndex valueModelIndex(int slicePos);
     QModelIndex labelModelIndex(int slicePos);
+    QVector<qreal> sliceValuesFromModel();
     void insertData(int start, int end);
     void removeData(int start, int end);
 
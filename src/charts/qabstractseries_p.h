@@ -83,7 +83,7 @@ public:
     ChartItem* chartItem() { return m_item.data(); }
 
     virtual void setDomain(AbstractDomain* domain);
-    AbstractDomain* domain() { return m_domain.data(); }
+    AbstractDomain* domain() const { return m_domain.data(); }
 
     virtual void setPresenter(ChartPresenter *presenter);
     ChartPresenter *presenter() const;
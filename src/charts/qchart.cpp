@@ -105,6 +105,31 @@ QT_CHARTS_BEGIN_NAMESPACE
  The easing curve of the animation for the chart.
  */
 
+/*!
+ \property QChart::animationSuppressionInterval
+ The minimum interval in milliseconds between two animated data changes of a series.
+
+ When series animations are enabled, a change to the data of a line, spline, scatter or area
+ series that follows the previous change of the same series within this interval is shown
+ without animation, and an animation that is still running is stopped. A series that is
+ updated continuously, such as a live feed, is therefore not animated, while occasional changes
+ are. The default value is \c 0, which means that every change is animated.
+
+ \sa animationOptions, animationPointLimit
+ */
+
+/*!
+ \property QChart::animationPointLimit
+ The maximum number of points of a series whose data changes are animated.
+
+ When series animations are enabled, changes to the data of a line, spline, scatter or area
+ series with more points than this are shown without animation, as interpolating every point
+ of a large series on every frame is expensive. The default value is \c 0, which means that
+ there is no limit.
+
+ \sa animationOptions, animationSuppressionInterval
+ */
+
 /*!
  \property QChart::backgroundVisible
  Specifies whether the chart background is visible or not.
@@ -636,6 +661,26 @@ QEasingCurve QChart::animationEasingCurve() const
     return d_ptr->m_presenter->animationEasingCurve();
 }
 
+void QChart::setAnimationSuppressionInterval(int msecs)
+{
+    d_ptr->m_presenter->setAnimationSuppressionInterval(msecs);
+}
+
+int QChart::animationSuppressionInterval() const
+{
+    return d_ptr->m_presenter->animationSuppressionInterval();
+}
+
+void QChart::setAnimationPointLimit(int count)
+{
+    d_ptr->m_presenter->setAnimationPointLimit(count);
+}
+
+int QChart::animationPointLimit() const
+{
+    return d_ptr->m_presenter->animationPointLimit();
+}
+
 /*!
     Scrolls the visible area of the chart by the distance defined in the \a dx and \a dy.
 
@@ -58,6 +58,8 @@ class QT_CHARTS_EXPORT QChart : public QGraphicsWidget
     Q_PROPERTY(QChart::AnimationOptions animationOptions READ animationOptions WRITE setAnimationOptions)
     Q_PROPERTY(int animationDuration READ animationDuration WRITE setAnimationDuration)
     Q_PROPERTY(QEasingCurve animationEasingCurve READ animationEasingCurve WRITE setAnimationEasingCurve)
+    Q_PROPERTY(int animationSuppressionInterval READ animationSuppressionInterval WRITE setAnimationSuppressionInterval)
+    Q_PROPERTY(int animationPointLimit READ animationPointLimit WRITE setAnimationPointLimit)
     Q_PROPERTY(QMargins margins READ margins WRITE setMargins)
     Q_PROPERTY(QChart::ChartType chartType READ chartType)
     Q_PROPERTY(bool plotAreaBackgroundVisible READ isPlotAreaBackgroundVisible WRITE setPlotAreaBackgroundVisible)
@@ -145,6 +147,10 @@ public:
     int animationDuration() const;
     void setAnimationEasingCurve(const QEasingCurve &curve);
     QEasingCurve animationEasingCurve() const;
+    void setAnimationSuppressionInterval(int msecs);
+    int animationSuppressionInterval() const;
+    void setAnimationPointLimit(int count);
+    int animationPointLimit() const;
 
     void zoomIn();
     void zoomOut();
@@ -0,0 +1,98 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCharts/QModelSectionReader>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+/*!
+    \class QModelSectionReader
+    \inmodule Qt Charts
+    \brief The QModelSectionReader class is an interface for reading the values of a model
+    section as numbers.
+
+    Model mappers read the values of a model through QAbstractItemModel::data(), one
+    QVariant at a time, and convert each of them to a number. For models with hundreds of
+    thousands of rows this dominates the time it takes to initialize the series. A model that
+    stores its values as numbers can implement this interface in addition to
+    QAbstractItemModel, so that the mappers copy the values of whole sections instead.
+
+    The model declares the interface with the Q_INTERFACES() macro, so that the mappers find it
+    with qobject_cast():
+
+    \code
+    class MeasurementModel : public QAbstractTableModel, public QModelSectionReader
+    {
+        Q_OBJECT
+        Q_INTERFACES(QtCharts::QModelSectionReader)
+    public:
+        bool readSection(Qt::Orientation orientation, int section, int first, int count,
+                         qreal *values, int stride) const
+        {
+            if (orientation != Qt::Vertical)
+                return false;
+            const QVector<qreal> &column = m_columns.at(section);
+            for (int i = 0; i < count; i++)
+                values[i * stride] = column.at(first + i);
+            return true;
+        }
+        ...
+    };
+    \endcode
+
+    The mappers call data() for models that do not implement the interface, for the labels of
+    slices and bar sets, and for the values of sections that readSection() declines to read.
+
+    \sa QXYModelMapper, QBarModelMapper, QPieModelMapper, QBoxPlotModelMapper,
+    QCandlestickModelMapper
+*/
+
+/*!
+    \fn QModelSectionReader::~QModelSectionReader()
+    Destroys the reader.
+*/
+
+/*!
+    \fn bool QModelSectionReader::readSection(Qt::Orientation orientation, int section, int first, int count, qreal *values, int stride) const
+
+    Copies \a count values of the model \a section, starting from the value at \a first, to
+    \a values. The values are written \a stride elements apart, so that the values of two
+    sections can be interleaved into one array. If \a orientation is Qt::Vertical, the section
+    is a column and the values are read from its rows. If it is Qt::Horizontal, the section is
+    a row and the values are read from its columns.
+
+    The values must be the numbers the mappers would convert the Qt::DisplayRole data of the
+    same items to, and dates and times must be given in milliseconds since the epoch.
+    Returns \c true if the values were copied. Returns \c false if the section cannot be read
+    as numbers, in which case the mapper reads it through QAbstractItemModel::data().
+    The section and the values are always within the dimensions of the model.
+*/
+
+QT_CHARTS_END_NAMESPACE
@@ -53,6 +53,10 @@
     ...
     chart->addSeries(series);
     \endcode
+
+    Series with up to a thousand points draw every marker as a separate graphics item. Larger
+    series draw all of their markers in one pass, which keeps drawing and mouse interaction fast
+    even with hundreds of thousands of points.
 */
 /*!
     \qmltype ScatterSeries
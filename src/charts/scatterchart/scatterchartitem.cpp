@@ -36,10 +36,15 @@
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsScene>
 #include <QtCore/QDebug>
+#include <QtCore/QtMath>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Series with more points than this are drawn as a batch by the chart item instead of creating
+// a marker item for every point.
+static const int maxMarkerItems = 1000;
+
 ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
@@ -52,6 +57,13 @@ ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
       m_pointLabelsFont(series->pointLabelsFont()),
       m_pointLabelsColor(series->pointLabelsColor()),
       m_pointLabelsClipping(true),
+      m_batched(false),
+      m_markerPixmapAntialiased(false),
+      m_markerGridDirty(true),
+      m_markerGridCellSize(1.0),
+      m_markerGridColumns(0),
+      m_markerGridRows(0),
+      m_hoveredMarker(-1),
       m_mousePressed(false)
 {
     QObject::connect(m_series->d_func(), SIGNAL(updated()), this, SLOT(handleUpdated()));
@@ -78,6 +90,14 @@ QRectF ScatterChartItem::boundingRect() const
     return m_rect;
 }
 
+bool ScatterChartItem::contains(const QPointF &point) const
+{
+    // Batched markers are hit only at the markers, so that the items below get the rest
+    if (m_batched)
+        return markerAt(point) >= 0;
+    return XYChart::contains(point);
+}
+
 void ScatterChartItem::createPoints(int count)
 {
     for (int i = 0; i < count; ++i) {
@@ -144,6 +164,7 @@ void ScatterChartItem::updateGeometry()
     if (m_series->useOpenGL()) {
         if (m_items.childItems().count())
             deletePoints(m_items.childItems().count());
+        setBatched(false);
         if (!m_rect.isEmpty()) {
             prepareGeometryChange();
             // Changed signal seems to trigger even with empty region
@@ -157,8 +178,20 @@ void ScatterChartItem::updateGeometry()
 
     if (points.size() == 0) {
         deletePoints(m_items.childItems().count());
+        setBatched(false);
+        return;
+    }
+
+    if (points.size() > maxMarkerItems) {
+        if (!m_batched) {
+            deletePoints(m_items.childItems().count());
+            setBatched(true);
+            handleUpdated();
+        }
+        updateBatchedGeometry(points);
         return;
     }
+    setBatched(false);
 
     int diff = m_items.childItems().size() - points.size();
 
@@ -192,7 +225,7 @@ void ScatterChartItem::updateGeometry()
             // Note that marker map values can be technically incorrect during the animation,
             // if it was caused by an insert, but this shouldn't be a problem as the points are
             // fake anyway. After remove animation stops, geometry is updated to correct one.
-            m_markerMap[item] = m_series->at(qMin(seriesLastIndex, i));
+            m_markerMap[item] = m_series->at(qMin(seriesLastIndex, m_firstPoint + i));
             QPointF position;
             if (seriesPrivate()->reverseXAxis())
                 position.setX(domain()->size().width() - point.x() - rect.width() / 2);
@@ -216,6 +249,228 @@ void ScatterChartItem::updateGeometry()
     }
 }
 
+void ScatterChartItem::setBatched(bool batched)
+{
+    if (m_batched == batched)
+        return;
+    m_batched = batched;
+    setAcceptHoverEvents(batched);
+    m_markerCenters.clear();
+    m_markerIndexes.clear();
+    m_markerPixmap = QPixmap();
+    m_markerGridDirty = true;
+    m_hoveredMarker = -1;
+    update();
+}
+
+void ScatterChartItem::updateBatchedGeometry(const QVector<QPointF> &points)
+{
+    QRectF clipRect(QPointF(0, 0), domain()->size());
+
+    // See updateGeometry() for the int limits
+    if (clipRect.height() > INT_MAX || clipRect.width() > INT_MAX)
+        return;
+
+    const QVector<bool> offGridStatus = offGridStatusVector();
+    // See updateGeometry() for explanation why seriesLastIndex is needed
+    const int seriesLastIndex = m_series->count() - 1;
+    const bool reverseX = seriesPrivate()->reverseXAxis();
+    const bool reverseY = seriesPrivate()->reverseYAxis();
+
+    m_markerCenters.resize(0);
+    m_markerIndexes.resize(0);
+    m_markerCenters.reserve(points.size());
+    m_markerIndexes.reserve(points.size());
+    for (int i = 0; i < points.size(); i++) {
+        if (offGridStatus.at(i))
+            continue;
+        const QPointF &point = points.at(i);
+        m_markerCenters.append(QPointF(reverseX ? clipRect.width() - point.x() : point.x(),
+                                       reverseY ? clipRect.height() - point.y() : point.y()));
+        m_markerIndexes.append(qMin(seriesLastIndex, m_firstPoint + i));
+    }
+    m_markerGridDirty = true;
+
+    prepareGeometryChange();
+    m_rect = clipRect;
+    update();
+}
+
+void ScatterChartItem::paintBatched(QPainter *painter)
+{
+    if (!m_visible || m_markerCenters.isEmpty())
+        return;
+
+    // All markers look the same, so one marker is rendered into a pixmap that is then copied
+    // to the center of every marker.
+    const qreal devicePixelRatio = painter->device()->devicePixelRatioF();
+    const bool antialiased = painter->testRenderHint(QPainter::Antialiasing);
+    if (m_markerPixmap.isNull() || m_markerPixmap.devicePixelRatioF() != devicePixelRatio
+            || m_markerPixmapAntialiased != antialiased) {
+        const QPen pen = m_series->pen();
+        const int side = qCeil(m_size + qMax(pen.widthF(), qreal(1.0))) + 2;
+        QPixmap pixmap(qCeil(side * devicePixelRatio), qCeil(side * devicePixelRatio));
+        pixmap.setDevicePixelRatio(devicePixelRatio);
+        pixmap.fill(Qt::transparent);
+        QPainter markerPainter(&pixmap);
+        markerPainter.setRenderHint(QPainter::Antialiasing, antialiased);
+        markerPainter.setPen(pen);
+        markerPainter.setBrush(m_series->brush());
+        const QRectF markerRect((side - m_size) / 2.0, (side - m_size) / 2.0, m_size, m_size);
+        if (m_shape == QScatterSeries::MarkerShapeCircle)
+            markerPainter.drawEllipse(markerRect);
+        else
+            markerPainter.drawRect(markerRect);
+        markerPainter.end();
+        m_markerPixmap = pixmap;
+        m_markerPixmapAntialiased = antialiased;
+    }
+
+    const qreal offset = m_markerPixmap.width() / devicePixelRatio / 2.0;
+    foreach (const QPointF &center, m_markerCenters)
+        painter->drawPixmap(QPointF(center.x() - offset, center.y() - offset), m_markerPixmap);
+}
+
+void ScatterChartItem::updateMarkerGrid() const
+{
+    const QSizeF size = domain()->size();
+    m_markerGridCellSize = qMax(qreal(m_size), qreal(1.0));
+    m_markerGridColumns = qMax(1, qCeil(size.width() / m_markerGridCellSize));
+    m_markerGridRows = qMax(1, qCeil(size.height() / m_markerGridCellSize));
+    // Keep the number of cells in proportion to the number of markers
+    const qint64 maxCells = qMax(4096, m_markerCenters.size() * 4);
+    while (qint64(m_markerGridColumns) * m_markerGridRows > maxCells) {
+        m_markerGridCellSize *= 2.0;
+        m_markerGridColumns = qMax(1, qCeil(size.width() / m_markerGridCellSize));
+        m_markerGridRows = qMax(1, qCeil(size.height() / m_markerGridCellSize));
+    }
+
+    // Counting sort of the markers by cell
+    const int cellCount = m_markerGridColumns * m_markerGridRows;
+    QVector<int> cells(m_markerCenters.size());
+    m_markerGridStarts.fill(0, cellCount + 1);
+    for (int i = 0; i < m_markerCenters.size(); i++) {
+        const QPointF &center = m_markerCenters.at(i);
+        const int column = qBound(0, int(center.x() / m_markerGridCellSize),
+                                  m_markerGridColumns - 1);
+        const int row = qBound(0, int(center.y() / m_markerGridCellSize), m_markerGridRows - 1);
+        cells[i] = row * m_markerGridColumns + column;
+        m_markerGridStarts[cells.at(i) + 1]++;
+    }
+    for (int cell = 0; cell < cellCount; cell++)
+        m_markerGridStarts[cell + 1] += m_markerGridStarts.at(cell);
+    QVector<int> next = m_markerGridStarts;
+    m_markerGridMarkers.resize(m_markerCenters.size());
+    for (int i = 0; i < m_markerCenters.size(); i++)
+        m_markerGridMarkers[next[cells.at(i)]++] = i;
+
+    m_markerGridDirty = false;
+}
+
+// Returns the topmost batched marker at pos, or -1 if there is none.
+int ScatterChartItem::markerAt(const QPointF &pos) const
+{
+    if (!m_visible || m_markerCenters.isEmpty())
+        return -1;
+    if (m_markerGridDirty)
+        updateMarkerGrid();
+
+    // Cells are at least as large as the markers, so the markers containing pos are in the
+    // cells that a marker centered at pos would overlap.
+    const qreal radius = m_size / 2.0;
+    const int firstColumn = qMax(0, qFloor((pos.x() - radius) / m_markerGridCellSize));
+    const int lastColumn = qMin(m_markerGridColumns - 1,
+                                qFloor((pos.x() + radius) / m_markerGridCellSize));
+    const int firstRow = qMax(0, qFloor((pos.y() - radius) / m_markerGridCellSize));
+    const int lastRow = qMin(m_markerGridRows - 1,
+                             qFloor((pos.y() + radius) / m_markerGridCellSize));
+
+    int marker = -1;
+    for (int row = firstRow; row <= lastRow; row++) {
+        for (int column = firstColumn; column <= lastColumn; column++) {
+            const int cell = row * m_markerGridColumns + column;
+            for (int j = m_markerGridStarts.at(cell); j < m_markerGridStarts.at(cell + 1); j++) {
+                const int i = m_markerGridMarkers.at(j);
+                if (i < marker)
+                    continue;
+                const qreal dx = pos.x() - m_markerCenters.at(i).x();
+                const qreal dy = pos.y() - m_markerCenters.at(i).y();
+                bool hit;
+                if (m_shape == QScatterSeries::MarkerShapeCircle)
+                    hit = dx * dx + dy * dy <= radius * radius;
+                else
+                    hit = qAbs(dx) <= radius && qAbs(dy) <= radius;
+                // Later markers are drawn on top
+                if (hit)
+                    marker = i;
+            }
+        }
+    }
+    return marker;
+}
+
+void ScatterChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int marker = m_batched ? markerAt(event->pos()) : -1;
+    if (marker < 0) {
+        XYChart::mousePressEvent(event);
+        return;
+    }
+    m_pressedPoint = m_series->at(m_markerIndexes.at(marker));
+    emit XYChart::pressed(m_pressedPoint);
+    setMousePressed();
+    event->accept();
+}
+
+void ScatterChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    if (!m_batched) {
+        XYChart::mouseReleaseEvent(event);
+        return;
+    }
+    emit XYChart::released(m_pressedPoint);
+    if (mousePressed())
+        emit XYChart::clicked(m_pressedPoint);
+    setMousePressed(false);
+}
+
+void ScatterChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int marker = m_batched ? markerAt(event->pos()) : -1;
+    if (marker < 0) {
+        XYChart::mouseDoubleClickEvent(event);
+        return;
+    }
+    emit XYChart::doubleClicked(m_series->at(m_markerIndexes.at(marker)));
+}
+
+void ScatterChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
+
+void ScatterChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    const int marker = m_batched ? markerAt(event->pos()) : -1;
+    if (marker == m_hoveredMarker)
+        return;
+    if (m_hoveredMarker >= 0)
+        emit XYChart::hovered(m_hoveredPoint, false);
+    m_hoveredMarker = marker;
+    if (marker >= 0) {
+        m_hoveredPoint = m_series->at(m_markerIndexes.at(marker));
+        emit XYChart::hovered(m_hoveredPoint, true);
+    }
+}
+
+void ScatterChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+    if (m_hoveredMarker >= 0)
+        emit XYChart::hovered(m_hoveredPoint, false);
+    m_hoveredMarker = -1;
+}
+
 void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
     Q_UNUSED(option)
@@ -229,6 +484,9 @@ void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     painter->save();
     painter->setClipRect(clipRect);
 
+    if (m_batched)
+        paintBatched(painter);
+
     if (m_pointLabelsVisible) {
         if (m_pointLabelsClipping)
             painter->setClipping(true);
@@ -236,7 +494,7 @@ void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
             painter->setClipping(false);
         m_series->d_func()->drawSeriesPointLabels(painter, m_points,
                                                   m_series->markerSize() / 2
-                                                  + m_series->pen().width());
+                                                  + m_series->pen().width(), m_firstPoint);
     }
 
     painter->restore();
@@ -258,7 +516,7 @@ void ScatterChartItem::handleUpdated()
 {
     int count = m_items.childItems().count();
 
-    if (count == 0)
+    if (count == 0 && !m_batched)
         return;
 
     bool recreate = m_visible != m_series->isVisible()
@@ -275,7 +533,11 @@ void ScatterChartItem::handleUpdated()
     m_pointLabelsColor = m_series->pointLabelsColor();
     m_pointLabelsClipping = m_series->pointLabelsClipping();
 
-    if (recreate) {
+    if (m_batched) {
+        // Marker looks and sizes are resolved when painting and hit testing
+        m_markerPixmap = QPixmap();
+        m_markerGridDirty = true;
+    } else if (recreate) {
         deletePoints(count);
         createPoints(count);
 
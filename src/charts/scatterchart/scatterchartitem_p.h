@@ -43,6 +43,7 @@
 #include <private/xychart_p.h>
 #include <QtWidgets/QGraphicsEllipseItem>
 #include <QtGui/QPen>
+#include <QtGui/QPixmap>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -59,6 +60,7 @@ public:
 public:
     //from QGraphicsItem
     QRectF boundingRect() const;
+    bool contains(const QPointF &point) const;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
 
     void setPen(const QPen &pen);
@@ -80,9 +82,20 @@ public Q_SLOTS:
 private:
     void createPoints(int count);
     void deletePoints(int count);
+    void setBatched(bool batched);
+    void updateBatchedGeometry(const QVector<QPointF> &points);
+    void paintBatched(QPainter *painter);
+    void updateMarkerGrid() const;
+    int markerAt(const QPointF &pos) const;
 
 protected:
     void updateGeometry();
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
 
 private:
     QScatterSeries *m_series;
@@ -93,6 +106,24 @@ private:
     QRectF m_rect;
     QMap<QGraphicsItem *, QPointF> m_markerMap;
 
+    // Series with many points are drawn by this item itself instead of marker items. Marker
+    // centers are stored in item coordinates along with the series index of each marker,
+    // and a uniform grid of the markers resolves mouse events.
+    bool m_batched;
+    QVector<QPointF> m_markerCenters;
+    QVector<int> m_markerIndexes;
+    QPixmap m_markerPixmap;
+    bool m_markerPixmapAntialiased;
+    mutable bool m_markerGridDirty;
+    mutable qreal m_markerGridCellSize;
+    mutable int m_markerGridColumns;
+    mutable int m_markerGridRows;
+    mutable QVector<int> m_markerGridStarts;
+    mutable QVector<int> m_markerGridMarkers;
+    int m_hoveredMarker;
+    QPointF m_hoveredPoint;
+    QPointF m_pressedPoint;
+
     bool m_pointLabelsVisible;
     QString m_pointLabelsFormat;
     QFont m_pointLabelsFont;
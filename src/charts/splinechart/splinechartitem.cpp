@@ -32,11 +32,17 @@
 #include <private/chartpresenter_p.h>
 #include <private/splineanimation_p.h>
 #include <private/polardomain_p.h>
+#include <private/xygeometrytask_p.h>
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Number of segments on each side of a changed point whose control points are solved again.
+// The influence of a point on the control points decays by a factor of 2 - sqrt(3), about 0.27,
+// per segment, so beyond this distance the change is below the precision of qreal.
+static const int controlPointWindow = 32;
+
 SplineChartItem::SplineChartItem(QSplineSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
@@ -52,6 +58,9 @@ SplineChartItem::SplineChartItem(QSplineSeries *series, QGraphicsItem *item)
     setAcceptHoverEvents(true);
     setFlag(QGraphicsItem::ItemIsSelectable);
     setZValue(ChartPresenter::SplineChartZValue);
+    // The control points of the visible segments depend on the points within the solver window,
+    // so those are kept when the geometry is culled.
+    m_cullingMargin = controlPointWindow + 1;
     QObject::connect(m_series->d_func(), SIGNAL(updated()), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(visibleChanged()), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(opacityChanged()), this, SLOT(handleUpdated()));
@@ -79,6 +88,11 @@ void SplineChartItem::setAnimation(SplineAnimation *animation)
 {
     m_animation = animation;
     XYChart::setAnimation(animation);
+    // Animations need the control points of all the points to start from
+    if (m_animation && m_points.count() >= 2
+            && m_controlPoints.count() != m_points.count() * 2 - 2) {
+        m_controlPoints = calculateControlPoints(m_points);
+    }
 }
 
 ChartAnimation *SplineChartItem::animation() const
@@ -98,29 +112,93 @@ QVector<QPointF> SplineChartItem::controlGeometryPoints() const
 
 void SplineChartItem::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index)
 {
+    // A decimated spline gets the control points of the reduced points in updateGeometry(),
+    // so the control points of all the points are only needed for animations.
     QVector<QPointF> controlPoints;
-    if (newPoints.count() >= 2)
+    if (newPoints.count() >= 2 && (m_animation || !isDecimated()))
         controlPoints = calculateControlPoints(newPoints);
 
-    if (m_animation)
+    updateSpline(oldPoints, newPoints, controlPoints, index);
+}
+
+void SplineChartItem::appendGeometry(const QVector<QPointF> &points)
+{
+    const int oldCount = m_points.count();
+    if (oldCount < 3 || m_controlPoints.count() != oldCount * 2 - 2) {
+        XYChart::appendGeometry(points);
+        return;
+    }
+
+    // The last segment of the old points is no longer the end of the spline, so the control
+    // points are solved from the window before it to the end.
+    QVector<QPointF> newPoints = m_points;
+    newPoints += points;
+    QVector<QPointF> controlPoints = m_controlPoints;
+    // Drop the shared copy so that resizing does not copy all the control points
+    m_controlPoints = QVector<QPointF>();
+    controlPoints.resize(newPoints.count() * 2 - 2);
+    solveControlPoints(newPoints, controlPoints, qMax(0, oldCount - 2 - controlPointWindow),
+                       newPoints.count() - 2);
+    updateSpline(m_points, newPoints, controlPoints, oldCount);
+}
+
+void SplineChartItem::replaceGeometry(int index, const QPointF &point)
+{
+    const int count = m_points.count();
+    if (count < 3 || m_controlPoints.count() != count * 2 - 2) {
+        XYChart::replaceGeometry(index, point);
+        return;
+    }
+
+    // The point is used by the segments before and after it
+    QVector<QPointF> newPoints = m_points;
+    newPoints.replace(index, point);
+    QVector<QPointF> controlPoints = m_controlPoints;
+    solveControlPoints(newPoints, controlPoints, qMax(0, index - 1 - controlPointWindow),
+                       qMin(count - 2, index + controlPointWindow));
+    updateSpline(m_points, newPoints, controlPoints, index);
+}
+
+void SplineChartItem::updateSpline(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints,
+                                   QVector<QPointF> &controlPoints, int index)
+{
+    const bool animated = isAnimated(newPoints.count());
+    if (animated)
         m_animation->setup(oldPoints, newPoints, m_controlPoints, controlPoints, index);
 
     m_points = newPoints;
     m_controlPoints = controlPoints;
     setDirty(false);
 
-    if (m_animation)
+    if (animated)
         presenter()->startAnimation(m_animation);
     else
         updateGeometry();
 }
 
+bool SplineChartItem::isDecimated() const
+{
+    return m_series->decimationMode() != QXYSeries::DecimationNone
+            && m_series->chart()->chartType() != QChart::ChartTypePolar;
+}
+
 void SplineChartItem::updateGeometry()
 {
-    const QVector<QPointF> &points = m_points;
-    const QVector<QPointF> &controlPoints = m_controlPoints;
+    QVector<QPointF> points = m_points;
+    QVector<QPointF> controlPoints = m_controlPoints;
+
+    if (points.size() >= 2 && isDecimated()) {
+        points = decimateGeometryPoints(m_points);
+        if (controlPoints.count() != points.count() * 2 - 2)
+            controlPoints = calculateControlPoints(points);
+    } else if (points.size() >= 2 && controlPoints.count() != points.count() * 2 - 2) {
+        // Decimation was turned off after the control points were last skipped
+        m_controlPoints = calculateControlPoints(m_points);
+        controlPoints = m_controlPoints;
+    }
 
     if ((points.size() < 2) || (controlPoints.size() < 2)) {
+        discardGeometryTask();
         prepareGeometryChange();
         m_path = QPainterPath();
         m_rect = QRect();
@@ -129,6 +207,23 @@ void SplineChartItem::updateGeometry()
 
     Q_ASSERT(points.count() * 2 - 2 == controlPoints.count());
 
+    if (m_series->chart()->chartType() != QChart::ChartTypePolar
+            && m_series->asynchronousGeometry()
+            && !(m_animation && m_animation->state() == QAbstractAnimation::Running)) {
+        if (XYGeometryTask *task = createGeometryTask()) {
+            // The points are decimated and the control points calculated above, so the task
+            // only builds the path and the shape
+            task->points = points;
+            task->controlPoints = controlPoints;
+            task->decimate = false;
+            task->strokeWidth = m_linePen.width() * 1.42;
+            task->miterLimit = m_linePen.miterLimit();
+            startGeometryTask(task);
+        }
+        return;
+    }
+    discardGeometryTask();
+
     QPainterPath splinePath;
     QPainterPath fullPath;
     // Use worst case scenario to determine required margin.
@@ -316,6 +411,19 @@ void SplineChartItem::updateGeometry()
     }
 }
 
+void SplineChartItem::applyGeometryTask(const XYGeometryTask *task)
+{
+    // Only zoom in if the bounding rects of the path fit inside int limits. QWidget::update() uses
+    // a region that has to be compatible with QRect.
+    if (task->valid) {
+        m_path = task->path;
+        prepareGeometryChange();
+        m_fullPath = task->shapePath;
+        m_rect = task->rect;
+    }
+    update();
+}
+
 /*!
   Calculates control points which are needed by QPainterPath.cubicTo function to draw the cubic Bezier cureve between two points.
   */
@@ -347,70 +455,74 @@ QVector<QPointF> SplineChartItem::calculateControlPoints(const QVector<QPointF>
     //  |   0   0   0   0   0   0   0   0   ... 1   4   1   |   |   P1_(n-1)|   |   4 * P(n-2) + 2 * P(n-1) |
     //  |   0   0   0   0   0   0   0   0   ... 0   2   7   |   |   P1_n    |   |   8 * P(n-1) + Pn         |
     //
-    QVector<qreal> vector;
-    vector.resize(n);
-
-    vector[0] = points[0].x() + 2 * points[1].x();
-
-
-    for (int i = 1; i < n - 1; ++i)
-        vector[i] = 4 * points[i].x() + 2 * points[i + 1].x();
-
-    vector[n - 1] = (8 * points[n - 1].x() + points[n].x()) / 2.0;
-
-    QVector<qreal> xControl = firstControlPoints(vector);
-
-    vector[0] = points[0].y() + 2 * points[1].y();
-
-    for (int i = 1; i < n - 1; ++i)
-        vector[i] = 4 * points[i].y() + 2 * points[i + 1].y();
-
-    vector[n - 1] = (8 * points[n - 1].y() + points[n].y()) / 2.0;
-
-    QVector<qreal> yControl = firstControlPoints(vector);
-
-    for (int i = 0, j = 0; i < n; ++i, ++j) {
-
-        controlPoints[j].setX(xControl[i]);
-        controlPoints[j].setY(yControl[i]);
-
-        j++;
-
-        if (i < n - 1) {
-            controlPoints[j].setX(2 * points[i + 1].x() - xControl[i + 1]);
-            controlPoints[j].setY(2 * points[i + 1].y() - yControl[i + 1]);
-        } else {
-            controlPoints[j].setX((points[n].x() + xControl[n - 1]) / 2);
-            controlPoints[j].setY((points[n].y() + yControl[n - 1]) / 2);
-        }
-    }
+    solveControlPoints(points, controlPoints, 0, n - 1);
     return controlPoints;
 }
 
-QVector<qreal> SplineChartItem::firstControlPoints(const QVector<qreal>& vector)
+/*!
+  Solves the control points of the segments from \a from to \a to of the spline through
+  \a points into \a controlPoints. The first control points of the segments just outside the
+  range are taken from \a controlPoints as they are, so that only the part of the spline around
+  a changed point needs to be solved again. The x and y coordinates are solved in one pass.
+  */
+void SplineChartItem::solveControlPoints(const QVector<QPointF> &points,
+                                         QVector<QPointF> &controlPoints, int from, int to)
 {
-    QVector<qreal> result;
-
-    int count = vector.count();
-    result.resize(count);
-    result[0] = vector[0] / 2.0;
+    const int n = points.count() - 1;
+    const int count = to - from + 1;
+
+    // The buffers are kept between calls to avoid allocating them for every update
+    m_solverFactors.resize(count);
+    m_solverValues.resize(count);
+    qreal *factors = m_solverFactors.data();
+    QPointF *values = m_solverValues.data();
+
+    // Forward sweep of the tridiagonal algorithm. The last row of the system is halved so that
+    // all the off-diagonal coefficients are one.
+    qreal b = 0;
+    for (int k = 0; k < count; k++) {
+        const int i = from + k;
+        QPointF value;
+        qreal diagonal;
+        if (i == 0) {
+            value = points[0] + 2 * points[1];
+            diagonal = 2.0;
+        } else if (i == n - 1) {
+            value = (8 * points[n - 1] + points[n]) / 2.0;
+            diagonal = 3.5;
+        } else {
+            value = 4 * points[i] + 2 * points[i + 1];
+            diagonal = 4.0;
+        }
+        if (k == 0 && i > 0)
+            value -= controlPoints[2 * (i - 1)];
+        if (k == count - 1 && i < n - 1)
+            value -= controlPoints[2 * (i + 1)];
+
+        if (k == 0) {
+            factors[0] = 0;
+            b = diagonal;
+            values[0] = value / b;
+        } else {
+            factors[k] = 1 / b;
+            b = diagonal - factors[k];
+            values[k] = (value - values[k - 1]) / b;
+        }
+    }
 
-    QVector<qreal> temp;
-    temp.resize(count);
-    temp[0] = 0;
+    for (int k = count - 2; k >= 0; k--)
+        values[k] -= factors[k + 1] * values[k + 1];
 
-    qreal b = 2.0;
+    for (int k = 0; k < count; k++)
+        controlPoints[2 * (from + k)] = values[k];
 
-    for (int i = 1; i < count; i++) {
-        temp[i] = 1 / b;
-        b = (i < count - 1 ? 4.0 : 3.5) - temp[i];
-        result[i] = (vector[i] - result[i - 1]) / b;
+    // The second control point of a segment mirrors the first control point of the next one
+    for (int i = qMax(0, from - 1); i <= to; i++) {
+        if (i < n - 1)
+            controlPoints[2 * i + 1] = 2 * points[i + 1] - controlPoints[2 * (i + 1)];
+        else
+            controlPoints[2 * i + 1] = (points[n] + controlPoints[2 * (n - 1)]) / 2;
     }
-
-    for (int i = 1; i < count; i++)
-        result[count - i - 1] -= temp[count - i] * result[count - i];
-
-    return result;
 }
 
 //handlers
@@ -479,7 +591,8 @@ void SplineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
             painter->setClipping(true);
         else
             painter->setClipping(false);
-        m_series->d_func()->drawSeriesPointLabels(painter, m_points, m_linePen.width() / 2);
+        m_series->d_func()->drawSeriesPointLabels(painter, m_points, m_linePen.width() / 2,
+                                                  m_firstPoint);
     }
 
     painter->restore();
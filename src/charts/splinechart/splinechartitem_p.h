@@ -60,6 +60,8 @@ public:
 
     void setControlGeometryPoints(QVector<QPointF>& points);
     QVector<QPointF> controlGeometryPoints() const;
+    QVector<QPointF> &controlGeometryBuffer() { return m_controlGeometryBuffer; }
+    void swapControlGeometryBuffer() { m_controlPoints.swap(m_controlGeometryBuffer); }
 
     void setAnimation(SplineAnimation *animation);
     ChartAnimation *animation() const;
@@ -70,8 +72,15 @@ public Q_SLOTS:
 protected:
     void updateGeometry();
     QVector<QPointF> calculateControlPoints(const QVector<QPointF> &points);
-    QVector<qreal> firstControlPoints(const QVector<qreal>& vector);
+    void solveControlPoints(const QVector<QPointF> &points, QVector<QPointF> &controlPoints,
+                            int from, int to);
+    bool isDecimated() const;
     void updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index);
+    void appendGeometry(const QVector<QPointF> &points);
+    void replaceGeometry(int index, const QPointF &point);
+    void updateSpline(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints,
+                      QVector<QPointF> &controlPoints, int index);
+    void applyGeometryTask(const XYGeometryTask *task);
     void mousePressEvent(QGraphicsSceneMouseEvent *event);
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
     void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
@@ -89,7 +98,10 @@ private:
     QPen m_pointPen;
     bool m_pointsVisible;
     QVector<QPointF> m_controlPoints;
+    QVector<QPointF> m_controlGeometryBuffer;
     QVector<QPointF> m_visiblePoints;
+    QVector<qreal> m_solverFactors;
+    QVector<QPointF> m_solverValues;
     SplineAnimation *m_animation;
 
     bool m_pointLabelsVisible;
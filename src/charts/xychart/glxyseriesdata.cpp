@@ -30,9 +30,15 @@
 #include "private/glxyseriesdata_p.h"
 #include "private/abstractdomain_p.h"
 #include <QtCharts/QScatterSeries>
+#include <QtCharts/QLogValueAxis>
+#include <cmath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// The values are rebased when the visible range is further than this many spans away from the
+// origin. Float values that far from the origin still resolve well below a pixel.
+static const qreal maxOriginDistance = 1000.0;
+
 GLXYSeriesDataManager::GLXYSeriesDataManager(QObject *parent)
     : QObject(parent),
       m_mapDirty(false)
@@ -72,64 +78,223 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
         m_mapDirty = true;
     }
     QVector<float> &array = data->array;
+    updateAxes(data, series);
+
+    int count = series->count();
+    int index = 0;
+    array.resize(count * 2);
+    data->offset = 0;
+
+    // Logarithms are taken on shaders, so log axes store the raw values. Values of linear axes
+    // are rebased to the center of the visible range before they are converted to floats.
+    const bool logX = data->logFactor.x() > 0.0f;
+    const bool logY = data->logFactor.y() > 0.0f;
+    data->origin = QPointF(logX ? 0.0 : (domain->minX() + domain->maxX()) / 2.0,
+                           logY ? 0.0 : (domain->minY() + domain->maxY()) / 2.0);
+    const qreal originX = data->origin.x();
+    const qreal originY = data->origin.y();
+    QVector<QPointF> seriesPoints = series->pointsVector();
+    for (int i = 0; i < count; i++) {
+        const QPointF &point = seriesPoints.at(i);
+        array[index++] = float(point.x() - originX);
+        array[index++] = float(point.y() - originY);
+    }
+    updateDomain(data, domain);
+    data->markChanged(0, array.size());
+}
+
+// Updates the series for a new visible range. Unless the range has drifted too far from the
+// origin of the values or the axis types have changed, only the uniforms need to change.
+void GLXYSeriesDataManager::setDomain(QXYSeries *series, const AbstractDomain *domain)
+{
+    GLXYSeriesData *data = incrementalData(series, domain, series->count());
+    if (data) {
+        const QVector2D logFactor = data->logFactor;
+        updateAxes(data, series);
+        if (data->logFactor == logFactor) {
+            updateDomain(data, domain);
+            // Values in the array are still valid, so nothing is marked changed
+            data->dirty = true;
+            return;
+        }
+    }
+    setPoints(series, domain);
+}
+
+void GLXYSeriesDataManager::shiftPoints(QXYSeries *series, const AbstractDomain *domain,
+                                        int removedCount, int addedCount)
+{
+    const int count = series->count();
+    GLXYSeriesData *data = incrementalData(series, domain, count - addedCount + removedCount);
+    if (!data) {
+        setPoints(series, domain);
+        return;
+    }
+
+    // Drop the oldest values and append the new ones. The retained values keep their place in
+    // the array, so only the appended values need to be uploaded.
+    removeFront(data, removedCount);
+    QVector<float> &array = data->array;
+    const int oldSize = array.size();
+    for (int i = count - addedCount; i < count; i++) {
+        const QPointF &point = series->at(i);
+        array.append(float(point.x() - data->origin.x()));
+        array.append(float(point.y() - data->origin.y()));
+    }
+    updateDomain(data, domain);
+    data->markChanged(oldSize, array.size());
+}
+
+void GLXYSeriesDataManager::insertPoints(QXYSeries *series, const AbstractDomain *domain,
+                                         int index, int count)
+{
+    GLXYSeriesData *data = incrementalData(series, domain, series->count() - count);
+    if (!data) {
+        setPoints(series, domain);
+        return;
+    }
+
+    // Values after the inserted ones move, so they need to be uploaded too. Appending
+    // only uploads the new values.
+    QVector<float> &array = data->array;
+    const int offset = data->offset;
+    array.insert(offset + index * 2, count * 2, 0.0f);
+    for (int i = index; i < index + count; i++) {
+        const QPointF &point = series->at(i);
+        array[offset + i * 2] = float(point.x() - data->origin.x());
+        array[offset + i * 2 + 1] = float(point.y() - data->origin.y());
+    }
+    updateDomain(data, domain);
+    data->markChanged(offset + index * 2, array.size());
+}
+
+void GLXYSeriesDataManager::replacePoints(QXYSeries *series, const AbstractDomain *domain,
+                                          int index, int count)
+{
+    GLXYSeriesData *data = incrementalData(series, domain, series->count());
+    if (!data) {
+        setPoints(series, domain);
+        return;
+    }
+
+    QVector<float> &array = data->array;
+    const int offset = data->offset;
+    for (int i = index; i < index + count; i++) {
+        const QPointF &point = series->at(i);
+        array[offset + i * 2] = float(point.x() - data->origin.x());
+        array[offset + i * 2 + 1] = float(point.y() - data->origin.y());
+    }
+    updateDomain(data, domain);
+    data->markChanged(offset + index * 2, offset + (index + count) * 2);
+}
+
+void GLXYSeriesDataManager::removePoints(QXYSeries *series, const AbstractDomain *domain,
+                                         int index, int count)
+{
+    GLXYSeriesData *data = incrementalData(series, domain, series->count() + count);
+    if (!data) {
+        setPoints(series, domain);
+        return;
+    }
+
+    // Removing from the start or the end only changes the range of values drawn
+    if (index == 0) {
+        removeFront(data, count);
+    } else {
+        QVector<float> &array = data->array;
+        array.remove(data->offset + index * 2, count * 2);
+        data->markChanged(data->offset + index * 2, array.size());
+    }
+    updateDomain(data, domain);
+}
+
+// Returns the data of the series if its values can be updated in place, i.e. the series has
+// data for oldCount points and the visible range has not drifted too far from the origin of
+// the values.
+GLXYSeriesData *GLXYSeriesDataManager::incrementalData(QXYSeries *series,
+                                                       const AbstractDomain *domain,
+                                                       int oldCount) const
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    if (!data || data->pointCount() != oldCount)
+        return 0;
+    // Values of log axes are not rebased
+    if ((data->logFactor.x() == 0.0f
+         && qAbs(domain->minX() - data->origin.x()) > maxOriginDistance * domain->spanX())
+            || (data->logFactor.y() == 0.0f
+                && qAbs(domain->minY() - data->origin.y()) > maxOriginDistance * domain->spanY())) {
+        return 0;
+    }
+    return data;
+}
+
+// Drops the values of the first count points by moving the offset past them. Once the dropped
+// values outnumber the retained ones, the retained values are moved to the start of the array
+// and uploaded again, so the array stays at most twice the size of the series and the cost of
+// the move is spread over the points dropped before it.
+void GLXYSeriesDataManager::removeFront(GLXYSeriesData *data, int count) const
+{
+    QVector<float> &array = data->array;
+    data->offset += count * 2;
+    if (data->offset >= array.size() - data->offset) {
+        array.remove(0, data->offset);
+        data->offset = 0;
+        data->markChanged(0, array.size());
+    } else {
+        // Only the range of values drawn changes
+        data->dirty = true;
+    }
+}
 
-    bool logAxis = false;
+void GLXYSeriesDataManager::updateAxes(GLXYSeriesData *data, const QXYSeries *series) const
+{
     bool reverseX = false;
     bool reverseY = false;
+    qreal logBaseX = 0;
+    qreal logBaseY = 0;
     foreach (QAbstractAxis* axis, series->attachedAxes()) {
         if (axis->type() == QAbstractAxis::AxisTypeLogValue) {
-            logAxis = true;
+            const qreal base = static_cast<QLogValueAxis *>(axis)->base();
+            if (axis->orientation() == Qt::Horizontal)
+                logBaseX = base;
+            else
+                logBaseY = base;
         }
         if (axis->isReverse()) {
             if (axis->orientation() == Qt::Horizontal)
                 reverseX = true;
             else
                 reverseY = true;
-            if (reverseX && reverseY)
-                break;
         }
     }
-    int count = series->count();
-    int index = 0;
-    array.resize(count * 2);
     QMatrix4x4 matrix;
     if (reverseX)
         matrix.scale(-1.0, 1.0);
     if (reverseY)
         matrix.scale(1.0, -1.0);
     data->matrix = matrix;
-    if (logAxis) {
-        // Use domain to resolve geometry points. Not as fast as shaders, but simpler that way
-        QVector<QPointF> geometryPoints = domain->calculateGeometryPoints(series->pointsVector());
-        const float height = domain->size().height();
-        if (geometryPoints.size()) {
-            for (int i = 0; i < count; i++) {
-                const QPointF &point = geometryPoints.at(i);
-                array[index++] = float(point.x());
-                array[index++] = float(height - point.y());
-            }
-        } else {
-            // If there are invalid log values, geometry points generation fails
-            for (int i = 0; i < count; i++) {
-                array[index++] = 0.0f;
-                array[index++] = 0.0f;
-            }
-        }
-        data->min = QVector2D(0, 0);
-        data->delta = QVector2D(domain->size().width() / 2.0f, domain->size().height() / 2.0f);
-    } else {
-        // Regular value axes, so we can do the math easily on shaders.
-        QVector<QPointF> seriesPoints = series->pointsVector();
-        for (int i = 0; i < count; i++) {
-            const QPointF &point = seriesPoints.at(i);
-            array[index++] = float(point.x());
-            array[index++] = float(point.y());
-        }
-        data->min = QVector2D(domain->minX(), domain->minY());
-        data->delta = QVector2D((domain->maxX() - domain->minX()) / 2.0f,
-                                (domain->maxY() - domain->minY()) / 2.0f);
+    data->logFactor = QVector2D(logBaseX > 0 ? 1.0 / std::log(logBaseX) : 0.0,
+                                logBaseY > 0 ? 1.0 / std::log(logBaseY) : 0.0);
+}
+
+void GLXYSeriesDataManager::updateDomain(GLXYSeriesData *data, const AbstractDomain *domain) const
+{
+    // The shader works relative to the origin, or in logarithms for log axes, so the range is
+    // converted the same way in double precision.
+    qreal minX = domain->minX() - data->origin.x();
+    qreal maxX = domain->maxX() - data->origin.x();
+    qreal minY = domain->minY() - data->origin.y();
+    qreal maxY = domain->maxY() - data->origin.y();
+    if (data->logFactor.x() > 0.0f) {
+        minX = std::log(minX) * data->logFactor.x();
+        maxX = std::log(maxX) * data->logFactor.x();
+    }
+    if (data->logFactor.y() > 0.0f) {
+        minY = std::log(minY) * data->logFactor.y();
+        maxY = std::log(maxY) * data->logFactor.y();
     }
-    data->dirty = true;
+    data->min = QVector2D(minX, minY);
+    data->delta = QVector2D((maxX - minX) / 2.0, (maxY - minY) / 2.0);
 }
 
 void GLXYSeriesDataManager::removeSeries(const QXYSeries *series)
@@ -52,25 +52,79 @@ class AbstractDomain;
 
 struct GLXYSeriesData {
     QVector<float> array;
+    // Number of values at the start of the array that belong to points already removed from the
+    // series. Dropping the oldest points only moves the offset, so that the retained values keep
+    // their place in the buffer and don't need to be uploaded again. The values are drawn from
+    // the offset on.
+    int offset;
     bool dirty;
+    // Range of array values changed since the last upload. The range is empty if only the
+    // number of values or the other properties changed.
+    int changedFrom;
+    int changedTo;
     QVector3D color;
     float width;
     QAbstractSeries::SeriesType type;
     QVector2D min;
     QVector2D delta;
     QMatrix4x4 matrix;
+    // The array values are stored relative to origin, so that they keep their precision as
+    // floats even when the series values are large, e.g. epoch milliseconds.
+    QPointF origin;
+    // 1 / ln(base) of a log axis, zero for linear axes. Log axes store the raw values and the
+    // shader takes the logarithms, so min and delta of log axes are logarithms as well.
+    QVector2D logFactor;
 public:
+    GLXYSeriesData()
+        : offset(0),
+          dirty(false),
+          changedFrom(0),
+          changedTo(0),
+          width(0.0f),
+          type(QAbstractSeries::SeriesTypeLine) {}
     GLXYSeriesData &operator=(const GLXYSeriesData &data) {
         array = data.array;
+        offset = data.offset;
         dirty = data.dirty;
+        changedFrom = data.changedFrom;
+        changedTo = data.changedTo;
         color = data.color;
         width = data.width;
         type = data.type;
         min = data.min;
         delta = data.delta;
         matrix = data.matrix;
+        origin = data.origin;
+        logFactor = data.logFactor;
         return *this;
     }
+
+    // These functions are needed by qml side, so they must be inline
+    void markChanged(int from, int to) {
+        if (changedFrom < changedTo) {
+            changedFrom = qMin(changedFrom, from);
+            changedTo = qMax(changedTo, to);
+        } else {
+            changedFrom = from;
+            changedTo = to;
+        }
+        dirty = true;
+    }
+    void clearChanged() {
+        dirty = false;
+        changedFrom = 0;
+        changedTo = 0;
+    }
+    int pointCount() const { return (array.size() - offset) / 2; }
+    // Takes over the state of data, keeping the changes of this data that are not uploaded yet.
+    void update(const GLXYSeriesData &data) {
+        const bool pending = dirty && changedFrom < changedTo;
+        const int from = changedFrom;
+        const int to = changedTo;
+        *this = data;
+        if (pending)
+            markChanged(from, to);
+    }
 };
 
 typedef QMap<const QXYSeries *, GLXYSeriesData *> GLXYDataMap;
@@ -85,6 +139,12 @@ public:
     ~GLXYSeriesDataManager();
 
     void setPoints(QXYSeries *series, const AbstractDomain *domain);
+    void setDomain(QXYSeries *series, const AbstractDomain *domain);
+    void shiftPoints(QXYSeries *series, const AbstractDomain *domain, int removedCount,
+                     int addedCount);
+    void insertPoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
+    void replacePoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
+    void removePoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
 
     void removeSeries(const QXYSeries *series);
 
@@ -95,7 +155,7 @@ public:
     void clearAllDirty() {
         m_mapDirty = false;
         foreach (GLXYSeriesData *data, m_seriesDataMap.values())
-            data->dirty = false;
+            data->clearChanged();
     }
     void handleAxisReverseChanged(const QList<QAbstractSeries *> &seriesList);
 
@@ -110,6 +170,12 @@ Q_SIGNALS:
     void seriesRemoved(const QXYSeries *series);
 
 private:
+    GLXYSeriesData *incrementalData(QXYSeries *series, const AbstractDomain *domain,
+                                    int oldCount) const;
+    void removeFront(GLXYSeriesData *data, int count) const;
+    void updateAxes(GLXYSeriesData *data, const QXYSeries *series) const;
+    void updateDomain(GLXYSeriesData *data, const AbstractDomain *domain) const;
+
     GLXYDataMap m_seriesDataMap;
     bool m_mapDirty;
 };
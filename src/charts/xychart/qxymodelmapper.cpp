@@ -30,6 +30,7 @@
 #include <QtCharts/QXYModelMapper>
 #include <private/qxymodelmapper_p.h>
 #include <QtCharts/QXYSeries>
+#include <QtCharts/QModelSectionReader>
 #include <QtCore/QAbstractItemModel>
 #include <QtCore/QDateTime>
 
@@ -102,10 +103,13 @@ void QXYModelMapper::setSeries(QXYSeries *series)
     d->initializeXYFromModel();
     // connect the signals from the series
     connect(d->m_series, SIGNAL(pointAdded(int)), d, SLOT(handlePointAdded(int)));
+    connect(d->m_series, SIGNAL(pointsAdded(int,int)), d, SLOT(handlePointsAdded(int,int)));
     connect(d->m_series, SIGNAL(pointRemoved(int)), d, SLOT(handlePointRemoved(int)));
     connect(d->m_series, SIGNAL(pointReplaced(int)), d, SLOT(handlePointReplaced(int)));
+    connect(d->m_series, SIGNAL(pointRangeReplaced(int,int)), d, SLOT(handlePointRangeReplaced(int,int)));
     connect(d->m_series, SIGNAL(destroyed()), d, SLOT(handleSeriesDestroyed()));
     connect(d->m_series, SIGNAL(pointsRemoved(int,int)), d, SLOT(handlePointsRemoved(int,int)));
+    connect(d->m_series, SIGNAL(pointsShifted(int,int)), d, SLOT(handlePointsShifted(int,int)));
 }
 
 /*!
@@ -300,8 +304,30 @@ void QXYModelMapperPrivate::handlePointAdded(int pointPos)
     else
         m_model->insertColumns(pointPos + m_first, 1);
 
-    setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
-    setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
+    setValueToModel(xModelIndex(pointPos), m_series->at(pointPos).x());
+    setValueToModel(yModelIndex(pointPos), m_series->at(pointPos).y());
+    blockModelSignals(false);
+}
+
+void QXYModelMapperPrivate::handlePointsAdded(int pointPos, int count)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    if (m_count != -1)
+        m_count += count;
+
+    blockModelSignals();
+    if (m_orientation == Qt::Vertical)
+        m_model->insertRows(pointPos + m_first, count);
+    else
+        m_model->insertColumns(pointPos + m_first, count);
+
+    const QVector<QPointF> points = m_series->pointsVector();
+    for (int i = pointPos; i < pointPos + count; i++) {
+        setValueToModel(xModelIndex(i), points.at(i).x());
+        setValueToModel(yModelIndex(i), points.at(i).y());
+    }
     blockModelSignals(false);
 }
 
@@ -339,14 +365,38 @@ void QXYModelMapperPrivate::handlePointsRemoved(int pointPos, int count)
     blockModelSignals(false);
 }
 
+void QXYModelMapperPrivate::handlePointsShifted(int removedCount, int addedCount)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    // Oldest points dropped out from the front, new points were appended to the end
+    handlePointsRemoved(0, removedCount);
+    handlePointsAdded(m_series->count() - addedCount, addedCount);
+}
+
 void QXYModelMapperPrivate::handlePointReplaced(int pointPos)
 {
     if (m_seriesSignalsBlock)
         return;
 
     blockModelSignals();
-    setValueToModel(xModelIndex(pointPos), m_series->points().at(pointPos).x());
-    setValueToModel(yModelIndex(pointPos), m_series->points().at(pointPos).y());
+    setValueToModel(xModelIndex(pointPos), m_series->at(pointPos).x());
+    setValueToModel(yModelIndex(pointPos), m_series->at(pointPos).y());
+    blockModelSignals(false);
+}
+
+void QXYModelMapperPrivate::handlePointRangeReplaced(int pointPos, int count)
+{
+    if (m_seriesSignalsBlock)
+        return;
+
+    blockModelSignals();
+    const QVector<QPointF> points = m_series->pointsVector();
+    for (int i = pointPos; i < pointPos + count; i++) {
+        setValueToModel(xModelIndex(i), points.at(i).x());
+        setValueToModel(yModelIndex(i), points.at(i).y());
+    }
     blockModelSignals(false);
 }
 
@@ -363,39 +413,32 @@ void QXYModelMapperPrivate::modelUpdated(QModelIndex topLeft, QModelIndex bottom
     if (m_modelSignalsBlock)
         return;
 
-    blockSeriesSignals();
-    QModelIndex index;
-    QPointF oldPoint;
-    QPointF newPoint;
-    for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
-        for (int column = topLeft.column(); column <= bottomRight.column(); column++) {
-            index = topLeft.sibling(row, column);
-            if (m_orientation == Qt::Vertical && (index.column() == m_xSection || index.column() == m_ySection)) {
-                if (index.row() >= m_first && (m_count == - 1 || index.row() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.row() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.row() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.row() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                    }
-                }
-            } else if (m_orientation == Qt::Horizontal && (index.row() == m_xSection || index.row() == m_ySection)) {
-                if (index.column() >= m_first && (m_count == - 1 || index.column() < m_first + m_count)) {
-                    QModelIndex xIndex = xModelIndex(index.column() - m_first);
-                    QModelIndex yIndex = yModelIndex(index.column() - m_first);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        oldPoint = m_series->points().at(index.column() - m_first);
-                        newPoint.setX(valueFromModel(xIndex));
-                        newPoint.setY(valueFromModel(yIndex));
-                    }
-                }
-            } else {
-                continue;
-            }
-            m_series->replace(oldPoint, newPoint);
-        }
+    // Points are laid out along the orientation, their x and y values are in the sections
+    int first = topLeft.row();
+    int last = bottomRight.row();
+    int firstSection = topLeft.column();
+    int lastSection = bottomRight.column();
+    if (m_orientation == Qt::Horizontal) {
+        first = topLeft.column();
+        last = bottomRight.column();
+        firstSection = topLeft.row();
+        lastSection = bottomRight.row();
     }
+    if ((m_xSection < firstSection || m_xSection > lastSection)
+            && (m_ySection < firstSection || m_ySection > lastSection)) {
+        return;
+    }
+
+    // The changed points are replaced as one range
+    const int pointPos = qMax(first, m_first) - m_first;
+    int pointEnd = qMin(last - m_first + 1, m_series->count());
+    if (m_count != -1)
+        pointEnd = qMin(pointEnd, m_count);
+    if (pointPos >= pointEnd)
+        return;
+
+    blockSeriesSignals();
+    m_series->replacePoints(pointPos, pointsFromModel(pointPos, pointEnd - pointPos));
     blockSeriesSignals(false);
 }
 
@@ -460,6 +503,52 @@ void QXYModelMapperPrivate::handleModelDestroyed()
     m_model = 0;
 }
 
+// Returns the number of points in the mapped part of the model.
+int QXYModelMapperPrivate::modelPointCount() const
+{
+    const bool vertical = m_orientation == Qt::Vertical;
+    const int sectionCount = vertical ? m_model->columnCount() : m_model->rowCount();
+    if (m_xSection < 0 || m_xSection >= sectionCount || m_ySection < 0 || m_ySection >= sectionCount)
+        return 0;
+
+    int count = qMax(0, (vertical ? m_model->rowCount() : m_model->columnCount()) - m_first);
+    if (m_count != -1)
+        count = qMin(count, m_count);
+    return count;
+}
+
+// Returns the points of count positions of the model starting at pointPos, up to the first
+// position whose x or y value is not in the model.
+QVector<QPointF> QXYModelMapperPrivate::pointsFromModel(int pointPos, int count)
+{
+    QVector<QPointF> points;
+    if (QModelSectionReader *reader = qobject_cast<QModelSectionReader *>(m_model)) {
+        // The x and y values are read straight into the coordinates of the points
+        const int readCount = qMin(count, modelPointCount() - pointPos);
+        if (readCount <= 0)
+            return points;
+        points.resize(readCount);
+        qreal *values = reinterpret_cast<qreal *>(points.data());
+        if (reader->readSection(m_orientation, m_xSection, pointPos + m_first, readCount,
+                                values, 2)
+                && reader->readSection(m_orientation, m_ySection, pointPos + m_first, readCount,
+                                       values + 1, 2)) {
+            return points;
+        }
+        points.clear();
+    }
+
+    points.reserve(count);
+    for (int i = pointPos; i < pointPos + count; i++) {
+        QModelIndex xIndex = xModelIndex(i);
+        QModelIndex yIndex = yModelIndex(i);
+        if (!xIndex.isValid() || !yIndex.isValid())
+            break;
+        points.append(QPointF(valueFromModel(xIndex), valueFromModel(yIndex)));
+    }
+    return points;
+}
+
 void QXYModelMapperPrivate::insertData(int start, int end)
 {
     if (m_model == 0 || m_series == 0)
@@ -473,22 +562,12 @@ void QXYModelMapperPrivate::insertData(int start, int end)
             addedCount = m_count;
         int first = qMax(start, m_first);
         int last = qMin(first + addedCount - 1, m_orientation == Qt::Vertical ? m_model->rowCount() - 1 : m_model->columnCount() - 1);
-        for (int i = first; i <= last; i++) {
-            QPointF point;
-            QModelIndex xIndex = xModelIndex(i - m_first);
-            QModelIndex yIndex = yModelIndex(i - m_first);
-            if (xIndex.isValid() && yIndex.isValid()) {
-                point.setX(valueFromModel(xIndex));
-                point.setY(valueFromModel(yIndex));
-                m_series->insert(i - m_first, point);
-            }
-        }
+        if (last >= first)
+            m_series->insertPoints(first - m_first, pointsFromModel(first - m_first, last - first + 1));
 
         // remove excess of points (above m_count)
-        if (m_count != -1 && m_series->points().size() > m_count)
-            for (int i = m_series->points().size() - 1; i >= m_count; i--) {
-                m_series->remove(m_series->points().at(i));
-            }
+        if (m_count != -1 && m_series->count() > m_count)
+            m_series->removePoints(m_count, m_series->count() - m_count);
     }
 }
 
@@ -504,9 +583,8 @@ void QXYModelMapperPrivate::removeData(int start, int end)
         int toRemove = qMin(m_series->count(), removedCount);     // first find how many items can actually be removed
         int first = qMax(start, m_first);    // get the index of the first item that will be removed.
         int last = qMin(first + toRemove - 1, m_series->count() + m_first - 1);    // get the index of the last item that will be removed.
-        for (int i = last; i >= first; i--) {
-            m_series->remove(m_series->points().at(i - m_first));
-        }
+        if (last >= first)
+            m_series->removePoints(first - m_first, last - first + 1);
 
         if (m_count != -1) {
             int itemsAvailable;     // check how many are available to be added
@@ -517,16 +595,7 @@ void QXYModelMapperPrivate::removeData(int start, int end)
             int toBeAdded = qMin(itemsAvailable, m_count - m_series->count());     // add not more items than there is space left to be filled.
             int currentSize = m_series->count();
             if (toBeAdded > 0)
-                for (int i = m_series->count(); i < currentSize + toBeAdded; i++) {
-                    QPointF point;
-                    QModelIndex xIndex = xModelIndex(i);
-                    QModelIndex yIndex = yModelIndex(i);
-                    if (xIndex.isValid() && yIndex.isValid()) {
-                        point.setX(valueFromModel(xIndex));
-                        point.setY(valueFromModel(yIndex));
-                        m_series->insert(i, point);
-                    }
-                }
+                m_series->insertPoints(currentSize, pointsFromModel(currentSize, toBeAdded));
         }
     }
 }
@@ -537,22 +606,8 @@ void QXYModelMapperPrivate::initializeXYFromModel()
         return;
 
     blockSeriesSignals();
-    // clear current content
-    m_series->clear();
-
-    // create the initial points set
-    int pointPos = 0;
-    QModelIndex xIndex = xModelIndex(pointPos);
-    QModelIndex yIndex = yModelIndex(pointPos);
-    while (xIndex.isValid() && yIndex.isValid()) {
-        QPointF point;
-        point.setX(valueFromModel(xIndex));
-        point.setY(valueFromModel(yIndex));
-        m_series->append(point);
-        pointPos++;
-        xIndex = xModelIndex(pointPos);
-        yIndex = yModelIndex(pointPos);
-    }
+    // replace the current content with the points of the model
+    m_series->replace(pointsFromModel(0, modelPointCount()));
     blockSeriesSignals(false);
 }
 
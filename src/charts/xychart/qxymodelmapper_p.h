@@ -41,11 +41,11 @@
 
 #include <QtCharts/QXYModelMapper>
 #include <QtCore/QObject>
+#include <QtCore/QVector>
 
 QT_BEGIN_NAMESPACE
 class QModelIndex;
 class QAbstractItemModel;
-class QPointF;
 QT_END_NAMESPACE
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -71,9 +71,12 @@ public Q_SLOTS:
 
     // for the series
     void handlePointAdded(int pointPos);
+    void handlePointsAdded(int pointPos, int count);
     void handlePointRemoved(int pointPos);
     void handlePointsRemoved(int pointPos, int count);
+    void handlePointsShifted(int removedCount, int addedCount);
     void handlePointReplaced(int pointPos);
+    void handlePointRangeReplaced(int pointPos, int count);
     void handleSeriesDestroyed();
 
     void initializeXYFromModel();
@@ -81,6 +84,8 @@ public Q_SLOTS:
 private:
     QModelIndex xModelIndex(int xPos);
     QModelIndex yModelIndex(int yPos);
+    int modelPointCount() const;
+    QVector<QPointF> pointsFromModel(int pointPos, int count);
     void insertData(int start, int end);
     void removeData(int start, int end);
     void blockModelSignals(bool block = true);
@@ -36,6 +36,8 @@
 #include <private/charthelpers_p.h>
 #include <private/qchart_p.h>
 #include <QtGui/QPainter>
+#include <limits>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -257,6 +259,99 @@ QT_CHARTS_BEGIN_NAMESPACE
     The clipping of the data point labels is changed to \a clipping.
 */
 
+/*!
+    \property QXYSeries::maximumPointCount
+    Defines the maximum number of points kept in the series. Zero, which is the default, means
+    that the number of points is not limited.
+
+    When the series is full, appending a point drops the oldest point out of the series and
+    QXYSeries::pointsShifted() is emitted instead of QXYSeries::pointRemoved() and
+    QXYSeries::pointAdded(). Charts handle the shift by reusing the already calculated geometry
+    of the retained points, which makes this the preferred way to show a scrolling window of
+    streamed data.
+
+    \sa pointsShifted()
+*/
+/*!
+    \qmlproperty int XYSeries::maximumPointCount
+    Defines the maximum number of points kept in the series. Zero, which is the default, means
+    that the number of points is not limited. When the series is full, appending a point drops
+    the oldest point out of the series.
+*/
+/*!
+    \fn void QXYSeries::maximumPointCountChanged(int count)
+    The maximum number of points kept in the series is changed to \a count.
+*/
+/*!
+    \qmlsignal XYSeries::onMaximumPointCountChanged(int count)
+    The maximum number of points kept in the series is changed to \a count.
+*/
+
+/*!
+    \enum QXYSeries::DecimationMode
+
+    This enum describes how the points of line and spline series are reduced before they
+    are drawn.
+
+    \value DecimationNone
+           All the points are drawn.
+    \value DecimationMinMax
+           Of each run of consecutive points that map to the same pixel column, only the first,
+           the last, the lowest and the highest point are drawn. The drawn line looks the same,
+           but the number of drawn vertices is bounded by the width of the plot area.
+*/
+
+/*!
+    \property QXYSeries::decimationMode
+    Defines how the points of the series are reduced before drawing. The default mode is
+    DecimationNone. Decimation is not done for polar charts, OpenGL accelerated series, or when
+    the points or point labels of the series are visible. For area series, set the mode on the
+    upper and lower series.
+*/
+/*!
+    \qmlproperty DecimationMode XYSeries::decimationMode
+    Defines how the points of the series are reduced before drawing. Either
+    XYSeries.DecimationNone or XYSeries.DecimationMinMax. The default mode is
+    XYSeries.DecimationNone.
+*/
+/*!
+    \fn void QXYSeries::decimationModeChanged(QXYSeries::DecimationMode mode)
+    The decimation mode of the series is changed to \a mode.
+*/
+/*!
+    \qmlsignal XYSeries::onDecimationModeChanged(DecimationMode mode)
+    The decimation mode of the series is changed to \a mode.
+*/
+
+/*!
+    \property QXYSeries::asynchronousGeometry
+    Defines whether the line of the series is built in a worker thread. The default value is
+    \c false.
+
+    Building the path and the shape used for detecting clicks and hovers takes long for series
+    with hundreds of thousands of points, and blocks input handling while it runs. When this
+    property is \c true, the path and the shape are built in the global QThreadPool, so several
+    series are built in parallel, and the chart shows the previous line until the new one is
+    ready. Results that are outdated by the time they are ready are discarded.
+
+    The property applies to line and spline series, including the upper and lower series of
+    area series, in cartesian charts. It is ignored for polar charts, OpenGL accelerated series,
+    and while the series is animated.
+*/
+/*!
+    \qmlproperty bool XYSeries::asynchronousGeometry
+    Defines whether the line of the series is built in a worker thread. The default value is
+    \c false. The property applies to line and spline series in cartesian charts.
+*/
+/*!
+    \fn void QXYSeries::asynchronousGeometryChanged(bool enabled)
+    Building the line of the series in a worker thread is \a enabled or disabled.
+*/
+/*!
+    \qmlsignal XYSeries::onAsynchronousGeometryChanged(bool enabled)
+    Building the line of the series in a worker thread is \a enabled or disabled.
+*/
+
 /*!
     \fn void QXYSeries::clicked(const QPointF& point)
     \brief Signal is emitted when user clicks the \a point on chart. The \a point is the point
@@ -357,6 +452,16 @@ QT_CHARTS_BEGIN_NAMESPACE
     Signal is emitted when a point has been replaced at \a index.
 */
 
+/*!
+    \fn void QXYSeries::pointRangeReplaced(int index, int count)
+    Signal is emitted when \a count points starting at \a index have been replaced.
+    \sa replacePoints()
+*/
+/*!
+    \qmlsignal XYSeries::onPointRangeReplaced(int index, int count)
+    Signal is emitted when \a count points starting at \a index have been replaced.
+*/
+
 /*!
     \fn void QXYSeries::pointsReplaced()
     Signal is emitted when all points have been replaced with other points.
@@ -377,6 +482,16 @@ QT_CHARTS_BEGIN_NAMESPACE
     Signal is emitted when a point has been added at \a index.
 */
 
+/*!
+    \fn void QXYSeries::pointsAdded(int index, int count)
+    Signal is emitted when \a count points have been added starting at \a index.
+    \sa append(), appendRange()
+*/
+/*!
+    \qmlsignal XYSeries::onPointsAdded(int index, int count)
+    Signal is emitted when \a count points have been added starting at \a index.
+*/
+
 /*!
     \fn void QXYSeries::pointRemoved(int index)
     Signal is emitted when a point has been removed from \a index.
@@ -399,6 +514,21 @@ QT_CHARTS_BEGIN_NAMESPACE
     Signal is emitted when a \a count of points has been removed starting at \a index.
 */
 
+/*!
+    \fn void QXYSeries::pointsShifted(int removedCount, int addedCount)
+    Signal is emitted when \a removedCount oldest points have been dropped from the beginning of
+    the series and \a addedCount points have been appended to the end of it, because the series
+    was at its maximum point count.
+    \sa maximumPointCount, append()
+*/
+
+/*!
+    \qmlsignal XYSeries::onPointsShifted(int removedCount, int addedCount)
+    Signal is emitted when \a removedCount oldest points have been dropped from the beginning of
+    the series and \a addedCount points have been appended to the end of it, because the series
+    was at its maximum point count.
+*/
+
 /*!
     \fn void QXYSeries::colorChanged(QColor color)
     \brief Signal is emitted when the line (pen) color has changed to \a color.
@@ -464,6 +594,15 @@ QT_CHARTS_BEGIN_NAMESPACE
 QXYSeries::QXYSeries(QXYSeriesPrivate &d, QObject *parent)
     : QAbstractSeries(d, parent)
 {
+    // Keep the indexes used by nearestPoint() up to date
+    QObject::connect(this, SIGNAL(pointAdded(int)), &d, SLOT(handlePointAdded(int)));
+    QObject::connect(this, SIGNAL(pointsAdded(int,int)), &d, SLOT(handlePointsAdded(int,int)));
+    QObject::connect(this, SIGNAL(pointRemoved(int)), &d, SLOT(handlePointRemoved(int)));
+    QObject::connect(this, SIGNAL(pointsRemoved(int,int)), &d, SLOT(handlePointsRemoved(int,int)));
+    QObject::connect(this, SIGNAL(pointsShifted(int,int)), &d, SLOT(handlePointsShifted(int,int)));
+    QObject::connect(this, SIGNAL(pointReplaced(int)), &d, SLOT(invalidatePointIndex()));
+    QObject::connect(this, SIGNAL(pointRangeReplaced(int,int)), &d, SLOT(invalidatePointIndex()));
+    QObject::connect(this, SIGNAL(pointsReplaced()), &d, SLOT(invalidatePointIndex()));
 }
 
 /*!
@@ -484,26 +623,74 @@ void QXYSeries::append(qreal x, qreal y)
 
 /*!
    This is an overloaded function.
-   Adds data \a point to the series.
+   Adds data \a point to the series. If the series already holds maximumPointCount points,
+   the oldest point is removed.
  */
 void QXYSeries::append(const QPointF &point)
 {
     Q_D(QXYSeries);
 
     if (isValidValue(point)) {
-        d->m_points << point;
-        emit pointAdded(d->m_points.count() - 1);
+        if (d->m_maximumPointCount > 0 && d->m_points.count() >= d->m_maximumPointCount) {
+            int removedCount = d->m_points.count() - d->m_maximumPointCount + 1;
+            d->m_points.remove(0, removedCount);
+            d->m_pointBounds.remove(0, removedCount, d->m_points.count());
+            d->m_points << point;
+            d->m_pointBounds.append(d->m_points, d->m_points.count() - 1);
+            d->updateXSorted(d->m_points.count() - 1, d->m_points.count());
+            emit pointsShifted(removedCount, 1);
+        } else {
+            d->m_points << point;
+            d->m_pointBounds.append(d->m_points, d->m_points.count() - 1);
+            d->updateXSorted(d->m_points.count() - 1, d->m_points.count());
+            emit pointAdded(d->m_points.count() - 1);
+        }
     }
 }
 
 /*!
    This is an overloaded function.
-   Adds list of data \a points to the series.
+   Adds list of data \a points to the series. Emits QXYSeries::pointsAdded() once for all the
+   added points. If the series would hold more than maximumPointCount points, the oldest points
+   are removed and QXYSeries::pointsShifted() is emitted instead.
+   \sa pointsAdded()
  */
 void QXYSeries::append(const QList<QPointF> &points)
 {
-    foreach (const QPointF &point , points)
-        append(point);
+    Q_D(QXYSeries);
+    const int oldCount = d->m_points.count();
+    d->m_points.reserve(oldCount + points.count());
+    foreach (const QPointF &point , points) {
+        if (isValidValue(point))
+            d->m_points.append(point);
+    }
+    d->finishAppend(oldCount);
+}
+
+/*!
+   Adds \a count data points to the series. The x values are read from \a x and the y values
+   from \a y. Consecutive values are \a xStride and \a yStride elements apart, which allows
+   reading the values directly from interleaved buffers. Points with invalid values are skipped.
+   Emits QXYSeries::pointsAdded() once for all the added points. If the series would hold more
+   than maximumPointCount points, the oldest points are removed and QXYSeries::pointsShifted()
+   is emitted instead.
+   \note This is much faster than appending the points one by one.
+   \sa pointsAdded()
+ */
+void QXYSeries::appendRange(const qreal *x, const qreal *y, int count, int xStride, int yStride)
+{
+    Q_D(QXYSeries);
+    if (count <= 0)
+        return;
+
+    const int oldCount = d->m_points.count();
+    d->m_points.reserve(oldCount + count);
+    for (int i = 0; i < count; i++) {
+        const QPointF point(x[i * xStride], y[i * yStride]);
+        if (isValidValue(point))
+            d->m_points.append(point);
+    }
+    d->finishAppend(oldCount);
 }
 
 /*!
@@ -545,11 +732,40 @@ void QXYSeries::replace(int index, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
     if (isValidValue(newPoint)) {
+        d->m_pointBounds.replace(index, d->m_points.at(index), newPoint);
         d->m_points[index] = newPoint;
+        d->updateXSorted(index, index + 1);
         emit pointReplaced(index);
     }
 }
 
+/*!
+  Replaces the points starting at \a index with \a points. Points that would be past the end
+  of the series and invalid points are ignored.
+  Emits QXYSeries::pointRangeReplaced() once for all the replaced points.
+  \note This is much faster than replacing the points one by one, and unlike replace() with a
+  vector of all the points it leaves the other points of the series as they are.
+  \sa pointRangeReplaced()
+*/
+void QXYSeries::replacePoints(int index, const QVector<QPointF> &points)
+{
+    Q_D(QXYSeries);
+    const int count = qMin(points.count(), d->m_points.count() - index);
+    if (index < 0 || count <= 0)
+        return;
+
+    QPointF *data = d->m_points.data() + index;
+    for (int i = 0; i < count; i++) {
+        const QPointF &point = points.at(i);
+        if (isValidValue(point)) {
+            d->m_pointBounds.replace(index + i, data[i], point);
+            data[i] = point;
+        }
+    }
+    d->updateXSorted(index, index + count);
+    emit pointRangeReplaced(index, count);
+}
+
 /*!
   Replaces the current points with \a points.
   \note This is much faster than replacing data points one by one,
@@ -567,13 +783,48 @@ void QXYSeries::replace(QList<QPointF> points)
   Replaces the current points with \a points.
   \note This is much faster than replacing data points one by one,
   or first clearing all data, and then appending the new data. Emits QXYSeries::pointsReplaced()
-  when the points have been replaced.
+  when the points have been replaced. If there are more than maximumPointCount \a points, only
+  the last ones are kept.
   \sa pointsReplaced()
 */
 void QXYSeries::replace(QVector<QPointF> points)
 {
     Q_D(QXYSeries);
+    if (d->m_maximumPointCount > 0 && points.count() > d->m_maximumPointCount)
+        points.remove(0, points.count() - d->m_maximumPointCount);
     d->m_points = points;
+    d->m_pointBounds.reset(d->m_points.count());
+    d->m_xSorted = true;
+    d->updateXSorted(0, d->m_points.count());
+    emit pointsReplaced();
+}
+
+/*!
+  Replaces the current points with \a count points whose x values are read from \a x and
+  y values from \a y. Consecutive values are \a xStride and \a yStride elements apart.
+  Points with invalid values are skipped. Emits QXYSeries::pointsReplaced() when the points
+  have been replaced. If there are more than maximumPointCount points, only the last ones are
+  kept.
+  \sa pointsReplaced()
+*/
+void QXYSeries::replaceRange(const qreal *x, const qreal *y, int count, int xStride, int yStride)
+{
+    Q_D(QXYSeries);
+    int first = 0;
+    if (d->m_maximumPointCount > 0 && count > d->m_maximumPointCount)
+        first = count - d->m_maximumPointCount;
+
+    QVector<QPointF> points;
+    points.reserve(qMax(0, count - first));
+    for (int i = first; i < count; i++) {
+        const QPointF point(x[i * xStride], y[i * yStride]);
+        if (isValidValue(point))
+            points.append(point);
+    }
+    d->m_points = points;
+    d->m_pointBounds.reset(d->m_points.count());
+    d->m_xSorted = true;
+    d->updateXSorted(0, d->m_points.count());
     emit pointsReplaced();
 }
 
@@ -607,6 +858,9 @@ void QXYSeries::remove(int index)
 {
     Q_D(QXYSeries);
     d->m_points.remove(index);
+    d->m_pointBounds.remove(index, 1, d->m_points.count());
+    if (d->m_points.isEmpty())
+        d->m_xSorted = true;
     emit pointRemoved(index);
 }
 
@@ -621,12 +875,16 @@ void QXYSeries::removePoints(int index, int count)
     Q_D(QXYSeries);
     if (count > 0) {
         d->m_points.remove(index, count);
+        d->m_pointBounds.remove(index, count, d->m_points.count());
+        if (d->m_points.isEmpty())
+            d->m_xSorted = true;
         emit pointsRemoved(index, count);
     }
 }
 
 /*!
-   Inserts a \a point in the series at \a index position.
+   Inserts a \a point in the series at \a index position. If the series then holds more than
+   maximumPointCount points, the oldest points are removed.
   \sa pointAdded()
 */
 void QXYSeries::insert(int index, const QPointF &point)
@@ -635,10 +893,51 @@ void QXYSeries::insert(int index, const QPointF &point)
     if (isValidValue(point)) {
         index = qMax(0, qMin(index, d->m_points.size()));
         d->m_points.insert(index, point);
+        d->m_pointBounds.insert(d->m_points, index, 1);
+        d->updateXSorted(index, index + 1);
         emit pointAdded(index);
+        if (d->m_maximumPointCount > 0 && d->m_points.count() > d->m_maximumPointCount)
+            removePoints(0, d->m_points.count() - d->m_maximumPointCount);
     }
 }
 
+/*!
+   Inserts \a points in the series at \a index position. Invalid points are ignored.
+   Emits QXYSeries::pointsAdded() once for all the inserted points. If the series then holds
+   more than maximumPointCount points, the oldest points are removed.
+   \note This is much faster than inserting the points one by one.
+  \sa pointsAdded()
+*/
+void QXYSeries::insertPoints(int index, const QVector<QPointF> &points)
+{
+    Q_D(QXYSeries);
+    QVector<QPointF> validPoints;
+    validPoints.reserve(points.count());
+    foreach (const QPointF &point, points) {
+        if (isValidValue(point))
+            validPoints.append(point);
+    }
+    const int count = validPoints.count();
+    if (count == 0)
+        return;
+
+    index = qMax(0, qMin(index, d->m_points.size()));
+    if (index == d->m_points.size()) {
+        const int oldCount = d->m_points.count();
+        d->m_points += validPoints;
+        d->finishAppend(oldCount);
+        return;
+    }
+
+    d->m_points.insert(index, count, QPointF());
+    std::copy(validPoints.constBegin(), validPoints.constEnd(), d->m_points.begin() + index);
+    d->m_pointBounds.insert(d->m_points, index, count);
+    d->updateXSorted(index, index + count);
+    emit pointsAdded(index, count);
+    if (d->m_maximumPointCount > 0 && d->m_points.count() > d->m_maximumPointCount)
+        removePoints(0, d->m_points.count() - d->m_maximumPointCount);
+}
+
 /*!
   Removes all points from the series.
   \sa pointsRemoved()
@@ -678,6 +977,88 @@ const QPointF &QXYSeries::at(int index) const
     return d->m_points.at(index);
 }
 
+/*!
+    Returns the index of the point nearest to \a value, or -1 if the series has no point within
+    \a maxDistance of it. A negative \a maxDistance means that the distance is not limited.
+
+    When the series is shown in a chart with value axes, the distance is measured in pixels of
+    the plot area, which makes the function suitable for resolving the point under the mouse
+    cursor for tooltips or crosshairs. Otherwise the distance is measured in series values.
+
+    The first query builds a spatial index of the points. The index is then kept up to date as
+    points are appended or dropped from the start of the series, and rebuilt on the next query
+    after other changes, so repeated queries take far less time than scanning all the points.
+
+    \sa QChart::mapToValue()
+*/
+int QXYSeries::nearestPoint(const QPointF &value, qreal maxDistance) const
+{
+    Q_D(const QXYSeries);
+    return d->nearestPoint(value, maxDistance);
+}
+
+/*!
+    Sets \a rect to the bounds of the points in the series and returns \c true. The left and
+    right edges of the rectangle are the minimum and maximum x values, and the top and bottom
+    edges the minimum and maximum y values. Returns \c false and leaves \a rect unchanged if the
+    series is empty.
+
+    The bounds are kept up to date as points are appended, so the function takes constant time
+    in most cases. After points are removed or replaced, the bounds are recalculated from
+    summaries of blocks of points instead of from every point.
+
+    \sa count()
+*/
+bool QXYSeries::boundingRect(QRectF *rect) const
+{
+    Q_D(const QXYSeries);
+    Q_ASSERT(rect);
+    return d->m_pointBounds.bounds(d->m_points, rect);
+}
+
+/*!
+    Sets \a rect to the bounds of the points whose x values are from \a minX to \a maxX and
+    returns \c true, which is useful for fitting the y-axis to the visible part of the series.
+    Returns \c false and leaves \a rect unchanged if there are no such points.
+
+    When the x values of the series are in ascending order, the points are looked up with a
+    binary search and the bounds of whole blocks of points are reused, so the cost does not
+    grow with the number of points in the range. Otherwise every point is checked.
+
+    \sa boundingRect()
+*/
+bool QXYSeries::boundingRect(qreal minX, qreal maxX, QRectF *rect) const
+{
+    Q_D(const QXYSeries);
+    Q_ASSERT(rect);
+    if (d->m_xSorted) {
+        const int from = std::lower_bound(d->m_points.constBegin(), d->m_points.constEnd(),
+                                          minX, pointXLessThan) - d->m_points.constBegin();
+        const int to = std::upper_bound(d->m_points.constBegin() + from, d->m_points.constEnd(),
+                                        maxX, xLessThanPoint) - d->m_points.constBegin();
+        return d->m_pointBounds.bounds(d->m_points, from, to, rect);
+    }
+
+    bool found = false;
+    QRectF bounds;
+    foreach (const QPointF &point, d->m_points) {
+        if (point.x() < minX || point.x() > maxX)
+            continue;
+        if (!found) {
+            bounds = QRectF(point, point);
+            found = true;
+        } else {
+            bounds.setLeft(qMin(bounds.left(), point.x()));
+            bounds.setRight(qMax(bounds.right(), point.x()));
+            bounds.setTop(qMin(bounds.top(), point.y()));
+            bounds.setBottom(qMax(bounds.bottom(), point.y()));
+        }
+    }
+    if (found)
+        *rect = bounds;
+    return found;
+}
+
 /*!
     Returns number of data points within series.
 */
@@ -845,6 +1226,54 @@ bool QXYSeries::pointLabelsClipping() const
     return d->m_pointLabelsClipping;
 }
 
+void QXYSeries::setMaximumPointCount(int count)
+{
+    Q_D(QXYSeries);
+    count = qMax(0, count);
+    if (d->m_maximumPointCount != count) {
+        d->m_maximumPointCount = count;
+        if (count > 0 && d->m_points.count() > count)
+            removePoints(0, d->m_points.count() - count);
+        emit maximumPointCountChanged(count);
+    }
+}
+
+int QXYSeries::maximumPointCount() const
+{
+    Q_D(const QXYSeries);
+    return d->m_maximumPointCount;
+}
+
+void QXYSeries::setDecimationMode(DecimationMode mode)
+{
+    Q_D(QXYSeries);
+    if (d->m_decimationMode != mode) {
+        d->m_decimationMode = mode;
+        emit decimationModeChanged(mode);
+    }
+}
+
+QXYSeries::DecimationMode QXYSeries::decimationMode() const
+{
+    Q_D(const QXYSeries);
+    return d->m_decimationMode;
+}
+
+void QXYSeries::setAsynchronousGeometry(bool enabled)
+{
+    Q_D(QXYSeries);
+    if (d->m_asynchronousGeometry != enabled) {
+        d->m_asynchronousGeometry = enabled;
+        emit asynchronousGeometryChanged(enabled);
+    }
+}
+
+bool QXYSeries::asynchronousGeometry() const
+{
+    Q_D(const QXYSeries);
+    return d->m_asynchronousGeometry;
+}
+
 /*!
     Stream operator for adding a data \a point to the series.
     \sa append()
@@ -879,8 +1308,162 @@ QXYSeriesPrivate::QXYSeriesPrivate(QXYSeries *q)
       m_pointLabelsVisible(false),
       m_pointLabelsFont(QChartPrivate::defaultFont()),
       m_pointLabelsColor(QChartPrivate::defaultPen().color()),
-      m_pointLabelsClipping(true)
+      m_pointLabelsClipping(true),
+      m_maximumPointCount(0),
+      m_decimationMode(QXYSeries::DecimationNone),
+      m_asynchronousGeometry(false),
+      m_xSorted(true),
+      m_geometryPointsValid(false)
+{
+}
+
+int QXYSeriesPrivate::nearestPoint(const QPointF &value, qreal maxDistance) const
+{
+    qreal scaleX = 1.0;
+    qreal scaleY = 1.0;
+    AbstractDomain *domain = this->domain();
+    if (m_chart && !domain->isEmpty()) {
+        if (domain->type() != AbstractDomain::XYDomain) {
+            // Distances on log and polar axes do not scale linearly with values, so compare
+            // geometry points instead
+            bool ok;
+            const QPointF position = domain->calculateGeometryPoint(value, ok);
+            if (!ok)
+                return -1;
+            if (!m_geometryPointsValid) {
+                m_geometryPoints.clear();
+                appendGeometryPoints(0);
+                m_geometryIndex.invalidate();
+                m_geometryPointsValid = true;
+            }
+            return m_geometryIndex.nearest(m_geometryPoints, position, 1.0, 1.0, maxDistance);
+        }
+        scaleX = domain->size().width() / domain->spanX();
+        scaleY = domain->size().height() / domain->spanY();
+    }
+    return m_pointIndex.nearest(m_points, value, scaleX, scaleY, maxDistance);
+}
+
+// Calculates the geometry points of the points from index from on into the cached geometry
+// points. Points that cannot be mapped, like non-positive values on log axes, are stored as NaN,
+// which the index leaves out.
+void QXYSeriesPrivate::appendGeometryPoints(int from) const
+{
+    const int count = m_points.size() - from;
+    QVector<bool> valid(count);
+    m_geometryPoints.resize(m_points.size());
+    domain()->calculateGeometryPoints(m_points.constData() + from, count,
+                                      m_geometryPoints.data() + from, valid.data());
+    for (int i = 0; i < count; i++) {
+        if (!valid.at(i))
+            m_geometryPoints[from + i] = QPointF(std::numeric_limits<qreal>::quiet_NaN(),
+                                                   std::numeric_limits<qreal>::quiet_NaN());
+    }
+}
+
+void QXYSeriesPrivate::setDomain(AbstractDomain *domain)
+{
+    QAbstractSeriesPrivate::setDomain(domain);
+    invalidateGeometryPoints();
+    QObject::connect(domain, SIGNAL(updated()), this, SLOT(invalidateGeometryPoints()),
+                     Qt::UniqueConnection);
+}
+
+void QXYSeriesPrivate::handlePointAdded(int index)
 {
+    handlePointsAdded(index, 1);
+}
+
+void QXYSeriesPrivate::handlePointsAdded(int index, int count)
+{
+    Q_UNUSED(count)
+    // Only appended points are added to the indexes, inserted points invalidate them
+    m_pointIndex.append(m_points, index);
+    if (!m_geometryPointsValid)
+        return;
+    if (index == m_geometryPoints.size()) {
+        appendGeometryPoints(index);
+        m_geometryIndex.append(m_geometryPoints, index);
+    } else {
+        invalidateGeometryPoints();
+    }
+}
+
+void QXYSeriesPrivate::handlePointRemoved(int index)
+{
+    handlePointsRemoved(index, 1);
+}
+
+void QXYSeriesPrivate::handlePointsRemoved(int index, int count)
+{
+    if (index == 0) {
+        m_pointIndex.removeFirst(count);
+        if (m_geometryPointsValid) {
+            m_geometryPoints.remove(0, count);
+            m_geometryIndex.removeFirst(count);
+        }
+    } else {
+        invalidatePointIndex();
+    }
+}
+
+void QXYSeriesPrivate::handlePointsShifted(int removedCount, int addedCount)
+{
+    handlePointsRemoved(0, removedCount);
+    handlePointsAdded(m_points.size() - addedCount, addedCount);
+}
+
+void QXYSeriesPrivate::invalidatePointIndex()
+{
+    m_pointIndex.invalidate();
+    invalidateGeometryPoints();
+}
+
+void QXYSeriesPrivate::invalidateGeometryPoints()
+{
+    m_geometryPointsValid = false;
+    m_geometryPoints.clear();
+}
+
+// Emits the signals for the points appended after the first oldCount points, dropping the oldest
+// points if the maximum point count is exceeded.
+void QXYSeriesPrivate::finishAppend(int oldCount)
+{
+    Q_Q(QXYSeries);
+    const int addedCount = m_points.count() - oldCount;
+    if (addedCount == 0)
+        return;
+    m_pointBounds.append(m_points, oldCount);
+    updateXSorted(oldCount, m_points.count());
+
+    if (m_maximumPointCount > 0 && m_points.count() > m_maximumPointCount) {
+        const int removedCount = m_points.count() - m_maximumPointCount;
+        m_points.remove(0, removedCount);
+        m_pointBounds.remove(0, removedCount, m_points.count());
+        if (addedCount < m_maximumPointCount)
+            emit q->pointsShifted(removedCount, addedCount);
+        else
+            emit q->pointsReplaced();
+    } else {
+        emit q->pointsAdded(oldCount, addedCount);
+    }
+}
+
+// Checks that the x values of the points from index from to index to, which have changed,
+// keep the points in ascending order. Once the order is broken, the series is not considered
+// sorted until all of its points are replaced or removed.
+void QXYSeriesPrivate::updateXSorted(int from, int to)
+{
+    if (!m_xSorted)
+        return;
+    const int last = qMin(to, m_points.count() - 1);
+    for (int i = qMax(1, from); i <= last; i++) {
+        // Also catches NaN values
+        if (!(m_points.at(i - 1).x() <= m_points.at(i).x())) {
+            m_xSorted = false;
+            return;
+        }
+    }
 }
 
 void QXYSeriesPrivate::initializeDomain()
@@ -890,24 +1473,12 @@ void QXYSeriesPrivate::initializeDomain()
     qreal maxX(1);
     qreal maxY(1);
 
-    Q_Q(QXYSeries);
-
-    const QVector<QPointF> &points = q->pointsVector();
-
-    if (!points.isEmpty()) {
-        minX = points[0].x();
-        minY = points[0].y();
-        maxX = minX;
-        maxY = minY;
-
-        for (int i = 0; i < points.count(); i++) {
-            qreal x = points[i].x();
-            qreal y = points[i].y();
-            minX = qMin(minX, x);
-            minY = qMin(minY, y);
-            maxX = qMax(maxX, x);
-            maxY = qMax(maxY, y);
-        }
+    QRectF bounds;
+    if (m_pointBounds.bounds(m_points, &bounds)) {
+        minX = bounds.left();
+        minY = bounds.top();
+        maxX = bounds.right();
+        maxY = bounds.bottom();
     }
 
     domain()->setRange(minX, maxX, minY, maxY);
@@ -952,8 +1523,9 @@ void QXYSeriesPrivate::initializeAnimations(QtCharts::QChart::AnimationOptions o
     QAbstractSeriesPrivate::initializeAnimations(options, duration, curve);
 }
 
+// Draws the labels of the points from series index firstPoint onwards at the geometry points.
 void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
-                                             const int offset)
+                                             const int offset, int firstPoint)
 {
     static const QString xPointTag(QLatin1String("@xPoint"));
     static const QString yPointTag(QLatin1String("@yPoint"));
@@ -964,10 +1536,12 @@ void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QVector<QP
     QFontMetrics fm(painter->font());
     // m_points is used for the label here as it has the series point information
     // points variable passed is used for positioning because it has the coordinates
-    for (int i(0); i < m_points.size(); i++) {
+    const int count = qMin(m_points.size() - firstPoint, points.size());
+    for (int i(0); i < count; i++) {
+        const QPointF &point = m_points.at(firstPoint + i);
         QString pointLabel = m_pointLabelsFormat;
-        pointLabel.replace(xPointTag, presenter()->numberToString(m_points.at(i).x()));
-        pointLabel.replace(yPointTag, presenter()->numberToString(m_points.at(i).y()));
+        pointLabel.replace(xPointTag, presenter()->numberToString(point.x()));
+        pointLabel.replace(yPointTag, presenter()->numberToString(point.y()));
 
         // Position text in relation to the point
         int pointLabelWidth = fm.width(pointLabel);
@@ -54,6 +54,16 @@ class QT_CHARTS_EXPORT QXYSeries : public QAbstractSeries
     Q_PROPERTY(QFont pointLabelsFont READ pointLabelsFont WRITE setPointLabelsFont NOTIFY pointLabelsFontChanged)
     Q_PROPERTY(QColor pointLabelsColor READ pointLabelsColor WRITE setPointLabelsColor NOTIFY pointLabelsColorChanged)
     Q_PROPERTY(bool pointLabelsClipping READ pointLabelsClipping WRITE setPointLabelsClipping NOTIFY pointLabelsClippingChanged)
+    Q_PROPERTY(int maximumPointCount READ maximumPointCount WRITE setMaximumPointCount NOTIFY maximumPointCountChanged)
+    Q_PROPERTY(DecimationMode decimationMode READ decimationMode WRITE setDecimationMode NOTIFY decimationModeChanged)
+    Q_PROPERTY(bool asynchronousGeometry READ asynchronousGeometry WRITE setAsynchronousGeometry NOTIFY asynchronousGeometryChanged)
+    Q_ENUMS(DecimationMode)
+
+public:
+    enum DecimationMode {
+        DecimationNone,
+        DecimationMinMax
+    };
 
 protected:
     explicit QXYSeries(QXYSeriesPrivate &d, QObject *parent = Q_NULLPTR);
@@ -63,6 +73,7 @@ public:
     void append(qreal x, qreal y);
     void append(const QPointF &point);
     void append(const QList<QPointF> &points);
+    void appendRange(const qreal *x, const qreal *y, int count, int xStride = 1, int yStride = 1);
     void replace(qreal oldX, qreal oldY, qreal newX, qreal newY);
     void replace(const QPointF &oldPoint, const QPointF &newPoint);
     void replace(int index, qreal newX, qreal newY);
@@ -72,12 +83,17 @@ public:
     void remove(int index);
     void removePoints(int index, int count);
     void insert(int index, const QPointF &point);
+    void insertPoints(int index, const QVector<QPointF> &points);
+    void replacePoints(int index, const QVector<QPointF> &points);
     void clear();
 
     int count() const;
     QList<QPointF> points() const;
     QVector<QPointF> pointsVector() const;
     const QPointF &at(int index) const;
+    int nearestPoint(const QPointF &value, qreal maxDistance = -1) const;
+    bool boundingRect(QRectF *rect) const;
+    bool boundingRect(qreal minX, qreal maxX, QRectF *rect) const;
 
     QXYSeries &operator << (const QPointF &point);
     QXYSeries &operator << (const QList<QPointF> &points);
@@ -109,8 +125,18 @@ public:
     void setPointLabelsClipping(bool enabled = true);
     bool pointLabelsClipping() const;
 
+    void setMaximumPointCount(int count);
+    int maximumPointCount() const;
+
+    void setDecimationMode(DecimationMode mode);
+    DecimationMode decimationMode() const;
+
+    void setAsynchronousGeometry(bool enabled);
+    bool asynchronousGeometry() const;
+
     void replace(QList<QPointF> points);
     void replace(QVector<QPointF> points);
+    void replaceRange(const qreal *x, const qreal *y, int count, int xStride = 1, int yStride = 1);
 
 Q_SIGNALS:
     void clicked(const QPointF &point);
@@ -119,8 +145,10 @@ Q_SIGNALS:
     void released(const QPointF &point);
     void doubleClicked(const QPointF &point);
     void pointReplaced(int index);
+    void pointRangeReplaced(int index, int count);
     void pointRemoved(int index);
     void pointAdded(int index);
+    void pointsAdded(int index, int count);
     void colorChanged(QColor color);
     void pointsReplaced();
     void pointLabelsFormatChanged(const QString &format);
@@ -129,6 +157,10 @@ Q_SIGNALS:
     void pointLabelsColorChanged(const QColor &color);
     void pointLabelsClippingChanged(bool clipping);
     void pointsRemoved(int index, int count);
+    void pointsShifted(int removedCount, int addedCount);
+    void maximumPointCountChanged(int count);
+    void decimationModeChanged(QXYSeries::DecimationMode mode);
+    void asynchronousGeometryChanged(bool enabled);
     void penChanged(const QPen &pen);
 
 private:
@@ -40,6 +40,9 @@
 #define QXYSERIES_P_H
 
 #include <private/qabstractseries_p.h>
+#include <private/xypointindex_p.h>
+#include <private/xypointbounds_p.h>
+#include <QtCharts/QXYSeries>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -53,6 +56,8 @@ class QXYSeriesPrivate: public QAbstractSeriesPrivate
 public:
     QXYSeriesPrivate(QXYSeries *q);
 
+    static QXYSeriesPrivate *get(QXYSeries *series) { return series->d_func(); }
+
     void initializeDomain();
     void initializeAxes();
     void initializeAnimations(QtCharts::QChart::AnimationOptions options, int duration,
@@ -63,12 +68,28 @@ public:
     QAbstractAxis::AxisType defaultAxisType(Qt::Orientation orientation) const;
     QAbstractAxis* createDefaultAxis(Qt::Orientation orientation) const;
 
+    void finishAppend(int oldCount);
+    void updateXSorted(int from, int to);
+    bool isXSorted() const { return m_xSorted; }
+    int nearestPoint(const QPointF &value, qreal maxDistance) const;
+
+    void setDomain(AbstractDomain *domain);
+
     void drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
-                               const int offset = 0);
+                               const int offset = 0, int firstPoint = 0);
 
 Q_SIGNALS:
     void updated();
 
+private Q_SLOTS:
+    void handlePointAdded(int index);
+    void handlePointsAdded(int index, int count);
+    void handlePointRemoved(int index);
+    void handlePointsRemoved(int index, int count);
+    void handlePointsShifted(int removedCount, int addedCount);
+    void invalidatePointIndex();
+    void invalidateGeometryPoints();
+
 protected:
     QVector<QPointF> m_points;
     QPen m_pen;
@@ -79,8 +100,23 @@ protected:
     QFont m_pointLabelsFont;
     QColor m_pointLabelsColor;
     bool m_pointLabelsClipping;
+    int m_maximumPointCount;
+    QXYSeries::DecimationMode m_decimationMode;
+    bool m_asynchronousGeometry;
+    // True while the x values are known to be in ascending order
+    bool m_xSorted;
+    mutable XYPointBounds m_pointBounds;
+    // Built by the first nearest point query and kept up to date as points are appended or
+    // removed from the front. On log and polar domains the query uses the cached geometry
+    // points instead, which are dropped whenever the domain changes.
+    mutable XYPointIndex m_pointIndex;
+    mutable XYPointIndex m_geometryIndex;
+    mutable QVector<QPointF> m_geometryPoints;
+    mutable bool m_geometryPointsValid;
 
 private:
+    void appendGeometryPoints(int from) const;
+
     Q_DECLARE_PUBLIC(QXYSeries)
     friend class QScatterSeries;
 };
@@ -36,8 +36,14 @@
 #include <private/glxyseriesdata_p.h>
 #include <QtCharts/QXYModelMapper>
 #include <private/qabstractaxis_p.h>
+#include <private/charthelpers_p.h>
+#include <private/xygeometrytask_p.h>
 #include <QtGui/QPainter>
 #include <QtCore/QAbstractItemModel>
+#include <QtCore/QtMath>
+#include <QtCore/QDebug>
+#include <QtCore/QThreadPool>
+#include <algorithm>
 
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -46,13 +52,26 @@ XYChart::XYChart(QXYSeries *series, QGraphicsItem *item):
       ChartItem(series->d_func(),item),
       m_series(series),
       m_animation(0),
-      m_dirty(true)
+      m_dirty(true),
+      m_firstPoint(0),
+      m_culled(false),
+      m_cullingEnabled(true),
+      m_cullingMargin(1),
+      m_geometryTaskId(0),
+      m_geometryTaskRunning(false),
+      m_geometryTaskQueued(false)
 {
     QObject::connect(series, SIGNAL(pointReplaced(int)), this, SLOT(handlePointReplaced(int)));
+    QObject::connect(series, SIGNAL(pointRangeReplaced(int, int)),
+                     this, SLOT(handlePointRangeReplaced(int, int)));
     QObject::connect(series, SIGNAL(pointsReplaced()), this, SLOT(handlePointsReplaced()));
     QObject::connect(series, SIGNAL(pointAdded(int)), this, SLOT(handlePointAdded(int)));
+    QObject::connect(series, SIGNAL(pointsAdded(int, int)), this, SLOT(handlePointsAdded(int, int)));
     QObject::connect(series, SIGNAL(pointRemoved(int)), this, SLOT(handlePointRemoved(int)));
     QObject::connect(series, SIGNAL(pointsRemoved(int, int)), this, SLOT(handlePointsRemoved(int, int)));
+    QObject::connect(series, SIGNAL(pointsShifted(int, int)), this, SLOT(handlePointsShifted(int, int)));
+    QObject::connect(series, SIGNAL(decimationModeChanged(QXYSeries::DecimationMode)),
+                     this, SLOT(handleDecimationModeChanged()));
     QObject::connect(this, SIGNAL(clicked(QPointF)), series, SIGNAL(clicked(QPointF)));
     QObject::connect(this, SIGNAL(hovered(QPointF,bool)), series, SIGNAL(hovered(QPointF,bool)));
     QObject::connect(this, SIGNAL(pressed(QPointF)), series, SIGNAL(pressed(QPointF)));
@@ -92,7 +111,7 @@ QVector<bool> XYChart::offGridStatusVector()
     const int seriesLastIndex = m_series->count() - 1;
 
     for (int i = 0; i < m_points.size(); i++) {
-        const QPointF &seriesPoint = m_series->at(qMin(seriesLastIndex, i));
+        const QPointF &seriesPoint = m_series->at(qMin(seriesLastIndex, m_firstPoint + i));
         if (seriesPoint.x() < minX
             || seriesPoint.x() > maxX
             || seriesPoint.y() < minY
@@ -108,17 +127,116 @@ QVector<bool> XYChart::offGridStatusVector()
 void XYChart::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index)
 {
 
-    if (m_animation) {
+    if (isAnimated(newPoints.count())) {
         m_animation->setup(oldPoints, newPoints, index);
         m_points = newPoints;
         setDirty(false);
         presenter()->startAnimation(m_animation);
     } else {
         m_points = newPoints;
+        setDirty(false);
         updateGeometry();
     }
 }
 
+// Returns true if a change to pointCount geometry points should be animated. When the presenter
+// suppresses the animation, a running or queued animation is cancelled so that the change is
+// shown at once.
+bool XYChart::isAnimated(int pointCount)
+{
+    if (!m_animation)
+        return false;
+    if (!presenter()->isAnimationSuppressed(m_animation, pointCount))
+        return true;
+    m_animation->cancel();
+    return false;
+}
+
+// Called when geometry points have been calculated for points appended to the end of
+// the series. Items that can extend their paths in place should reimplement this,
+// the default implementation does a regular chart update.
+void XYChart::appendGeometry(const QVector<QPointF> &points)
+{
+    QVector<QPointF> newPoints = m_points;
+    newPoints += points;
+    updateChart(m_points, newPoints, m_points.size());
+}
+
+// Called when the oldest removedCount points have dropped out of the series and geometry points
+// have been calculated for the points appended to its end. The geometry of the retained points
+// does not change, so it is reused instead of recalculated.
+void XYChart::shiftGeometry(int removedCount, const QVector<QPointF> &points)
+{
+    QVector<QPointF> newPoints = m_points.mid(removedCount);
+    newPoints += points;
+    updateChart(m_points, newPoints);
+}
+
+// Called when the point at index has been replaced and its new geometry point is valid. The
+// geometry of the other points does not change.
+void XYChart::replaceGeometry(int index, const QPointF &point)
+{
+    QVector<QPointF> points = m_points;
+    points.replace(index, point);
+    updateChart(m_points, points, index);
+}
+
+// Reduces the geometry points according to the decimation mode of the series. With
+// DecimationMinMax, each run of consecutive points within the same pixel column is replaced by
+// its first, lowest, highest and last point, which draws the same line with at most four
+// vertices per column. Returns the given points as is if nothing could be dropped.
+QVector<QPointF> XYChart::decimateGeometryPoints(const QVector<QPointF> &points) const
+{
+    if (m_series->decimationMode() == QXYSeries::DecimationNone)
+        return points;
+    return decimateMinMax(points, qCeil(domain()->size().width()));
+}
+
+// Reduces the points to the first, last, minimum and maximum point of each pixel column they
+// fall into. The columns are the expected number of columns, used to reserve memory. This does
+// not depend on the chart item, so it can be called from other threads.
+QVector<QPointF> XYChart::decimateMinMax(const QVector<QPointF> &points, int columns)
+{
+    const int size = points.size();
+    if (size <= 4)
+        return points;
+
+    QVector<QPointF> decimatedPoints;
+    decimatedPoints.reserve(qMin(size, 4 * (columns + 1)));
+
+    int first = 0;
+    while (first < size) {
+        const qreal column = std::floor(points.at(first).x());
+        int minIndex = first;
+        int maxIndex = first;
+        int last = first;
+        while (last + 1 < size && std::floor(points.at(last + 1).x()) == column) {
+            last++;
+            if (points.at(last).y() < points.at(minIndex).y())
+                minIndex = last;
+            else if (points.at(last).y() > points.at(maxIndex).y())
+                maxIndex = last;
+        }
+
+        // Keep the extremes in their original order so that the line is traced correctly
+        const int lower = qMin(minIndex, maxIndex);
+        const int upper = qMax(minIndex, maxIndex);
+        decimatedPoints.append(points.at(first));
+        if (lower != first && lower != last)
+            decimatedPoints.append(points.at(lower));
+        if (upper != lower && upper != first && upper != last)
+            decimatedPoints.append(points.at(upper));
+        if (last != first)
+            decimatedPoints.append(points.at(last));
+
+        first = last + 1;
+    }
+
+    if (decimatedPoints.size() == size)
+        return points;
+    return decimatedPoints;
+}
+
 void XYChart::updateGlChart()
 {
     dataSet()->glXYSeriesDataManager()->setPoints(m_series, domain());
@@ -126,6 +244,47 @@ void XYChart::updateGlChart()
     updateGeometry();
 }
 
+// Calculates the geometry points of the series. When the x values of the series are sorted, only
+// the points within the visible x-range and m_cullingMargin neighbours on each side, so that lines
+// continue to the edges of the plot area, are calculated. The series index of the first calculated
+// point is stored to m_firstPoint.
+QVector<QPointF> XYChart::calculateGeometryPoints()
+{
+    const QVector<QPointF> seriesPoints = m_series->pointsVector();
+    int from = 0;
+    int to = seriesPoints.size();
+
+    // Animations interpolate between whole series and polar charts wrap x around, so
+    // those are not culled.
+    const AbstractDomain::DomainType domainType = domain()->type();
+    if (m_cullingEnabled && !m_animation && m_series->d_func()->isXSorted()
+            && (domainType == AbstractDomain::XYDomain
+                || domainType == AbstractDomain::XLogYDomain
+                || domainType == AbstractDomain::LogXYDomain
+                || domainType == AbstractDomain::LogXLogYDomain)) {
+        from = std::lower_bound(seriesPoints.constBegin(), seriesPoints.constEnd(),
+                                domain()->minX(), pointXLessThan) - seriesPoints.constBegin();
+        to = std::upper_bound(seriesPoints.constBegin() + from, seriesPoints.constEnd(),
+                              domain()->maxX(), xLessThanPoint) - seriesPoints.constBegin();
+        from = qMax(0, from - m_cullingMargin);
+        to = qMin(seriesPoints.size(), to + m_cullingMargin);
+    }
+
+    m_firstPoint = from;
+    m_culled = from > 0 || to < seriesPoints.size();
+    if (!m_culled)
+        return domain()->calculateGeometryPoints(seriesPoints);
+
+    QVector<QPointF> points(to - from);
+    if (domain()->calculateGeometryPoints(seriesPoints.constData() + from, to - from,
+                                          points.data()) > 0) {
+        // Like for the whole series, invalid log values invalidate the geometry
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
+    }
+    return points;
+}
+
 //handlers
 
 void XYChart::handlePointAdded(int index)
@@ -134,15 +293,21 @@ void XYChart::handlePointAdded(int index)
     Q_ASSERT(index >= 0);
 
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->insertPoints(m_series, domain(), index, 1);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (m_dirty || m_points.isEmpty() || m_culled) {
+            points = calculateGeometryPoints();
         } else {
+            QPointF point = domain()->calculateGeometryPoint(m_series->at(index), m_validData);
+            if (m_validData && !m_animation && index == m_points.size()) {
+                // Point was appended, so the cached geometry only needs to be extended
+                appendGeometry(QVector<QPointF>() << point);
+                return;
+            }
             points = m_points;
-            QPointF point = domain()->calculateGeometryPoint(m_series->pointsVector().at(index),
-                                                             m_validData);
             if (!m_validData)
                 m_points.clear();
             else
@@ -152,17 +317,53 @@ void XYChart::handlePointAdded(int index)
     }
 }
 
+void XYChart::handlePointsAdded(int index, int count)
+{
+    Q_ASSERT(index + count <= m_series->count());
+    Q_ASSERT(index >= 0);
+
+    if (m_series->useOpenGL()) {
+        dataSet()->glXYSeriesDataManager()->insertPoints(m_series, domain(), index, count);
+        presenter()->updateGLWidget();
+        updateGeometry();
+    } else {
+        QVector<QPointF> points;
+        if (!m_dirty && !m_points.isEmpty() && !m_culled) {
+            // Map only the added points, straight from the series storage
+            const QVector<QPointF> seriesPoints = m_series->pointsVector();
+            QVector<QPointF> addedPoints(count);
+            if (domain()->calculateGeometryPoints(seriesPoints.constData() + index, count,
+                                                  addedPoints.data()) == 0) {
+                if (!m_animation && index == m_points.size()) {
+                    // Points were appended, so the cached geometry only needs to be extended
+                    appendGeometry(addedPoints);
+                    return;
+                }
+                points = m_points;
+                points.insert(index, count, QPointF());
+                std::copy(addedPoints.constBegin(), addedPoints.constEnd(), points.begin() + index);
+                updateChart(m_points, points, index);
+                return;
+            }
+        }
+        points = calculateGeometryPoints();
+        updateChart(m_points, points, index);
+    }
+}
+
 void XYChart::handlePointRemoved(int index)
 {
     Q_ASSERT(index <= m_series->count());
     Q_ASSERT(index >= 0);
 
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->removePoints(m_series, domain(), index, 1);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (m_dirty || m_points.isEmpty() || m_culled) {
+            points = calculateGeometryPoints();
         } else {
             points = m_points;
             points.remove(index);
@@ -177,11 +378,13 @@ void XYChart::handlePointsRemoved(int index, int count)
     Q_ASSERT(index >= 0);
 
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->removePoints(m_series, domain(), index, count);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (m_dirty || m_points.isEmpty() || m_culled) {
+            points = calculateGeometryPoints();
         } else {
             points = m_points;
             points.remove(index, count);
@@ -190,26 +393,89 @@ void XYChart::handlePointsRemoved(int index, int count)
     }
 }
 
+void XYChart::handlePointsShifted(int removedCount, int addedCount)
+{
+    Q_ASSERT(addedCount <= m_series->count());
+    Q_ASSERT(removedCount >= 0);
+
+    if (m_series->useOpenGL()) {
+        dataSet()->glXYSeriesDataManager()->shiftPoints(m_series, domain(), removedCount,
+                                                         addedCount);
+        presenter()->updateGLWidget();
+        updateGeometry();
+    } else {
+        const int count = m_series->count();
+        QVector<QPointF> points;
+        if (!m_dirty && !m_points.isEmpty() && !m_culled
+                && m_points.size() == count - addedCount + removedCount) {
+            // Only the new points need to be mapped, straight from the series storage
+            const QVector<QPointF> seriesPoints = m_series->pointsVector();
+            points.resize(addedCount);
+            if (domain()->calculateGeometryPoints(seriesPoints.constData() + count - addedCount,
+                                                  addedCount, points.data()) == 0) {
+                shiftGeometry(removedCount, points);
+                return;
+            }
+        }
+        points = calculateGeometryPoints();
+        updateChart(m_points, points);
+    }
+}
+
 void XYChart::handlePointReplaced(int index)
 {
     Q_ASSERT(index < m_series->count());
     Q_ASSERT(index >= 0);
 
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->replacePoints(m_series, domain(), index, 1);
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
         QVector<QPointF> points;
-        if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (m_dirty || m_points.isEmpty() || m_culled) {
+            points = calculateGeometryPoints();
         } else {
             QPointF point = domain()->calculateGeometryPoint(m_series->pointsVector().at(index),
                                                              m_validData);
-            if (!m_validData)
-                m_points.clear();
+            if (m_validData) {
+                replaceGeometry(index, point);
+                return;
+            }
+            m_points.clear();
+            points = m_points;
+        }
+        updateChart(m_points, points, index);
+    }
+}
+
+void XYChart::handlePointRangeReplaced(int index, int count)
+{
+    Q_ASSERT(index + count <= m_series->count());
+    Q_ASSERT(index >= 0);
+
+    if (count == 1) {
+        handlePointReplaced(index);
+        return;
+    }
+
+    if (m_series->useOpenGL()) {
+        dataSet()->glXYSeriesDataManager()->replacePoints(m_series, domain(), index, count);
+        presenter()->updateGLWidget();
+        updateGeometry();
+    } else {
+        QVector<QPointF> points;
+        if (!m_dirty && !m_points.isEmpty() && !m_culled && m_points.size() == m_series->count()) {
+            // Map only the replaced points, straight into a copy of the cached geometry
             points = m_points;
-            if (m_validData)
-                points.replace(index, point);
+            const QVector<QPointF> seriesPoints = m_series->pointsVector();
+            if (domain()->calculateGeometryPoints(seriesPoints.constData() + index, count,
+                                                  points.data() + index) == 0) {
+                updateChart(m_points, points, index);
+                return;
+            }
         }
+        points = calculateGeometryPoints();
         updateChart(m_points, points, index);
     }
 }
@@ -220,7 +486,7 @@ void XYChart::handlePointsReplaced()
         updateGlChart();
     } else {
         // All the points were replaced -> recalculate
-        QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        QVector<QPointF> points = calculateGeometryPoints();
         updateChart(m_points, points, -1);
     }
 }
@@ -228,19 +494,87 @@ void XYChart::handlePointsReplaced()
 void XYChart::handleDomainUpdated()
 {
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        dataSet()->glXYSeriesDataManager()->setDomain(m_series, domain());
+        presenter()->updateGLWidget();
+        updateGeometry();
     } else {
-        if (isEmpty()) return;
-        QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (isEmpty()) {
+            // Cached geometry no longer matches the domain
+            setDirty(true);
+            return;
+        }
+        QVector<QPointF> points = calculateGeometryPoints();
         updateChart(m_points, points);
     }
 }
 
+void XYChart::handleDecimationModeChanged()
+{
+    if (!m_series->useOpenGL() && !isEmpty() && !m_dirty)
+        updateGeometry();
+}
+
 bool XYChart::isEmpty()
 {
     return domain()->isEmpty() || m_series->points().isEmpty();
 }
 
+// Creates a task for building the geometry from the current geometry points asynchronously.
+// The caller fills in the rest of the inputs and passes it to startGeometryTask(). Returns null
+// if a task is already running, in which case the geometry is updated again when it finishes.
+XYGeometryTask *XYChart::createGeometryTask()
+{
+    if (m_geometryTaskRunning) {
+        m_geometryTaskQueued = true;
+        return 0;
+    }
+
+    XYGeometryTask *task = new XYGeometryTask(++m_geometryTaskId);
+    task->points = m_points;
+    task->decimate = m_series->decimationMode() != QXYSeries::DecimationNone;
+    task->decimateColumns = qCeil(domain()->size().width());
+    return task;
+}
+
+void XYChart::startGeometryTask(XYGeometryTask *task)
+{
+    m_geometryTaskRunning = true;
+    // The task deletes itself after the item has handled it, also if the item is gone by then
+    QObject::connect(task, SIGNAL(finished()), this, SLOT(handleGeometryTaskFinished()),
+                     Qt::QueuedConnection);
+    QObject::connect(task, SIGNAL(finished()), task, SLOT(deleteLater()), Qt::QueuedConnection);
+    QThreadPool::globalInstance()->start(task);
+}
+
+// Makes sure that the result of a running task is not applied, because the geometry has been
+// updated synchronously after the task was started.
+void XYChart::discardGeometryTask()
+{
+    if (m_geometryTaskRunning) {
+        m_geometryTaskId++;
+        m_geometryTaskQueued = false;
+    }
+}
+
+void XYChart::applyGeometryTask(const XYGeometryTask *task)
+{
+    Q_UNUSED(task)
+}
+
+void XYChart::handleGeometryTaskFinished()
+{
+    XYGeometryTask *task = qobject_cast<XYGeometryTask *>(sender());
+    m_geometryTaskRunning = false;
+    if (m_geometryTaskQueued) {
+        // The points changed while the task was running, so build again from the latest points
+        m_geometryTaskQueued = false;
+        updateGeometry();
+        return;
+    }
+    if (task && task->id() == m_geometryTaskId)
+        applyGeometryTask(task);
+}
+
 #include "moc_xychart_p.cpp"
 
 QT_CHARTS_END_NAMESPACE
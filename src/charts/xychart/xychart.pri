@@ -7,13 +7,19 @@ SOURCES += \
     $$PWD/qxymodelmapper.cpp \
     $$PWD/qvxymodelmapper.cpp \
     $$PWD/qhxymodelmapper.cpp  \
-    $$PWD/glxyseriesdata.cpp
+    $$PWD/glxyseriesdata.cpp \
+    $$PWD/xypointindex.cpp \
+    $$PWD/xypointbounds.cpp \
+    $$PWD/xygeometrytask.cpp
 
 PRIVATE_HEADERS += \
     $$PWD/xychart_p.h \
     $$PWD/qxyseries_p.h \
     $$PWD/qxymodelmapper_p.h \
-    $$PWD/glxyseriesdata_p.h
+    $$PWD/glxyseriesdata_p.h \
+    $$PWD/xypointindex_p.h \
+    $$PWD/xypointbounds_p.h \
+    $$PWD/xygeometrytask_p.h
 
 PUBLIC_HEADERS += \
     $$PWD/qxyseries.h \
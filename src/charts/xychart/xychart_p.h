@@ -49,6 +49,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 
 class ChartPresenter;
 class QXYSeries;
+class XYGeometryTask;
 
 class XYChart :  public ChartItem
 {
@@ -59,6 +60,10 @@ public:
 
     void setGeometryPoints(const QVector<QPointF> &points);
     QVector<QPointF> geometryPoints() const { return m_points; }
+    // Animations interpolate each frame into this buffer and swap it with the geometry points,
+    // so that the memory of the previous frame is reused.
+    QVector<QPointF> &geometryBuffer() { return m_geometryBuffer; }
+    void swapGeometryBuffer() { m_points.swap(m_geometryBuffer); }
 
     void setAnimation(XYAnimation *animation);
     ChartAnimation *animation() const { return m_animation; }
@@ -70,13 +75,22 @@ public:
     void getSeriesRanges(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY);
     QVector<bool> offGridStatusVector();
 
+    static QVector<QPointF> decimateMinMax(const QVector<QPointF> &points, int columns);
+
 public Q_SLOTS:
     void handlePointAdded(int index);
+    void handlePointsAdded(int index, int count);
     void handlePointRemoved(int index);
     void handlePointsRemoved(int index, int count);
+    void handlePointsShifted(int removedCount, int addedCount);
     void handlePointReplaced(int index);
+    void handlePointRangeReplaced(int index, int count);
     void handlePointsReplaced();
     void handleDomainUpdated();
+    void handleDecimationModeChanged();
+
+private Q_SLOTS:
+    void handleGeometryTaskFinished();
 
 Q_SIGNALS:
     void clicked(const QPointF &point);
@@ -87,7 +101,18 @@ Q_SIGNALS:
 
 protected:
     virtual void updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index = -1);
+    bool isAnimated(int pointCount);
     virtual void updateGlChart();
+    virtual void appendGeometry(const QVector<QPointF> &points);
+    virtual void shiftGeometry(int removedCount, const QVector<QPointF> &points);
+    virtual void replaceGeometry(int index, const QPointF &point);
+    QVector<QPointF> decimateGeometryPoints(const QVector<QPointF> &points) const;
+    QVector<QPointF> calculateGeometryPoints();
+    bool geometryTaskRunning() const { return m_geometryTaskRunning; }
+    XYGeometryTask *createGeometryTask();
+    void startGeometryTask(XYGeometryTask *task);
+    void discardGeometryTask();
+    virtual void applyGeometryTask(const XYGeometryTask *task);
 
 private:
     inline bool isEmpty();
@@ -95,8 +120,21 @@ private:
 protected:
     QXYSeries *m_series;
     QVector<QPointF> m_points;
+    QVector<QPointF> m_geometryBuffer;
     XYAnimation *m_animation;
     bool m_dirty;
+    // Series index of the first geometry point. Geometry of series sorted by x is culled to the
+    // visible x-range, in which case m_culled is set and incremental updates recalculate it.
+    int m_firstPoint;
+    bool m_culled;
+    bool m_cullingEnabled;
+    // Number of points kept on each side of the visible x-range when the geometry is culled
+    int m_cullingMargin;
+    // Asynchronous geometry: only one task runs at a time, and an update requested while it runs
+    // is queued. Results of tasks whose id is no longer current are discarded.
+    int m_geometryTaskId;
+    bool m_geometryTaskRunning;
+    bool m_geometryTaskQueued;
 
     friend class AreaChartItem;
 };
@@ -0,0 +1,90 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xygeometrytask_p.h>
+#include <private/xychart_p.h>
+#include <QtGui/QPainterPathStroker>
+#include <climits>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+XYGeometryTask::XYGeometryTask(int id)
+    : decimate(false),
+      decimateColumns(0),
+      markerSize(0),
+      strokeWidth(0),
+      miterLimit(2),
+      valid(false),
+      m_id(id)
+{
+    setAutoDelete(false);
+}
+
+void XYGeometryTask::run()
+{
+    if (decimate)
+        points = XYChart::decimateMinMax(points, decimateColumns);
+
+    if (!points.isEmpty()) {
+        path.moveTo(points.at(0));
+        if (!controlPoints.isEmpty()) {
+            for (int i = 0; i < points.size() - 1; i++)
+                path.cubicTo(controlPoints[2 * i], controlPoints[2 * i + 1], points.at(i + 1));
+        } else if (markerSize > 0) {
+            path.addEllipse(points.at(0), markerSize, markerSize);
+            path.moveTo(points.at(0));
+            for (int i = 1; i < points.size(); i++) {
+                path.lineTo(points.at(i));
+                path.addEllipse(points.at(i), markerSize, markerSize);
+                path.moveTo(points.at(i));
+            }
+        } else {
+            for (int i = 1; i < points.size(); i++)
+                path.lineTo(points.at(i));
+        }
+    }
+
+    QPainterPathStroker stroker;
+    stroker.setWidth(strokeWidth);
+    stroker.setJoinStyle(Qt::MiterJoin);
+    stroker.setCapStyle(Qt::SquareCap);
+    stroker.setMiterLimit(miterLimit);
+    shapePath = stroker.createStroke(path);
+    rect = shapePath.boundingRect();
+
+    const QRectF pathRect = path.boundingRect();
+    valid = rect.height() <= INT_MAX && rect.width() <= INT_MAX
+            && pathRect.height() <= INT_MAX && pathRect.width() <= INT_MAX;
+
+    emit finished();
+}
+
+#include "moc_xygeometrytask_p.cpp"
+
+QT_CHARTS_END_NAMESPACE
@@ -36,48 +36,57 @@
 //
 // We mean it.
 
-#ifndef BAR_H
-#define BAR_H
+
+#ifndef XYGEOMETRYTASK_H
+#define XYGEOMETRYTASK_H
 
 #include <QtCharts/QChartGlobal>
-#include <QtWidgets/QGraphicsRectItem>
+#include <QtCore/QObject>
+#include <QtCore/QRunnable>
+#include <QtCore/QVector>
+#include <QtCore/QPointF>
+#include <QtGui/QPainterPath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
-class QBarSet;
-
-// Single visual bar item of chart
-class Bar : public QObject, public QGraphicsRectItem
+// Builds the path and the hit-test shape of a line or spline series in a worker thread.
+// The inputs are copied from the chart item before the task is started, and the item
+// picks up the outputs on the GUI thread when finished() is emitted.
+class XYGeometryTask : public QObject, public QRunnable
 {
     Q_OBJECT
 public:
-    Bar(QBarSet *barset, int index, QGraphicsItem *parent = 0);
-    ~Bar();
+    XYGeometryTask(int id);
 
-public:
-    void mousePressEvent(QGraphicsSceneMouseEvent *event);
-    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
-    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
-    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
-    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+    int id() const { return m_id; }
 
-    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget = 0);
+    void run();
 
 Q_SIGNALS:
-    void clicked(int index, QBarSet *barset);
-    void hovered(bool status, int index, QBarSet *barset);
-    void pressed(int index, QBarSet *barset);
-    void released(int index, QBarSet *barset);
-    void doubleClicked(int index, QBarSet *barset);
+    void finished();
 
-private:
-    int m_index;
-    QBarSet *m_barset;
-    bool m_hovering;
+public:
+    // Input
+    QVector<QPointF> points;
+    // Two control points per segment, in which case the path is made of cubic curves
+    QVector<QPointF> controlPoints;
+    bool decimate;
+    int decimateColumns;
+    qreal markerSize;
+    qreal strokeWidth;
+    qreal miterLimit;
+
+    // Output
+    QPainterPath path;
+    QPainterPath shapePath;
+    QRectF rect;
+    // False if the geometry does not fit inside int limits
+    bool valid;
 
-    bool m_mousePressed;
+private:
+    int m_id;
 };
 
 QT_CHARTS_END_NAMESPACE
 
-#endif // BAR_H
+#endif // XYGEOMETRYTASK_H
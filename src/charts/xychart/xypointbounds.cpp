@@ -0,0 +1,237 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xypointbounds_p.h>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+static const int blockSize = 256;
+
+void XYPointBounds::Bounds::set(const QPointF &point)
+{
+    minX = maxX = point.x();
+    minY = maxY = point.y();
+    valid = true;
+}
+
+void XYPointBounds::Bounds::extend(const QPointF &point)
+{
+    if (!valid) {
+        set(point);
+        return;
+    }
+    minX = qMin(minX, point.x());
+    maxX = qMax(maxX, point.x());
+    minY = qMin(minY, point.y());
+    maxY = qMax(maxY, point.y());
+}
+
+void XYPointBounds::Bounds::extend(const Bounds &bounds)
+{
+    if (!bounds.valid)
+        return;
+    if (!valid) {
+        *this = bounds;
+        return;
+    }
+    minX = qMin(minX, bounds.minX);
+    maxX = qMax(maxX, bounds.maxX);
+    minY = qMin(minY, bounds.minY);
+    maxY = qMax(maxY, bounds.maxY);
+}
+
+// Returns true if removing point can not shrink the bounds
+bool XYPointBounds::Bounds::isInside(const QPointF &point) const
+{
+    return valid && point.x() > minX && point.x() < maxX && point.y() > minY && point.y() < maxY;
+}
+
+QRectF XYPointBounds::Bounds::toRect() const
+{
+    return QRectF(QPointF(minX, minY), QPointF(maxX, maxY));
+}
+
+XYPointBounds::XYPointBounds()
+    : m_offset(0)
+{
+}
+
+// Extends the bounds with the points from index from onwards, which were appended.
+void XYPointBounds::append(const QVector<QPointF> &points, int from)
+{
+    if (from == 0) {
+        m_blocks.clear();
+        m_offset = 0;
+    }
+    for (int i = from; i < points.size(); i++) {
+        const QPointF &point = points.at(i);
+        const int block = (i + m_offset) / blockSize;
+        if (block >= m_blocks.size()) {
+            // A new block is complete from its first point on
+            m_blocks.resize(block);
+            m_blocks.append(Bounds());
+            m_blocks.last().set(point);
+        } else if (m_blocks.at(block).valid) {
+            m_blocks[block].extend(point);
+        }
+        if (i == 0)
+            m_total.set(point);
+        else if (m_total.valid)
+            m_total.extend(point);
+    }
+}
+
+// Updates the bounds for count points inserted at index.
+void XYPointBounds::insert(const QVector<QPointF> &points, int index, int count)
+{
+    if (index + count == points.size()) {
+        append(points, index);
+        return;
+    }
+    invalidateBlocks(index);
+    resizeBlocks(points.size());
+    if (m_total.valid) {
+        for (int i = index; i < index + count; i++)
+            m_total.extend(points.at(i));
+    }
+}
+
+void XYPointBounds::replace(int index, const QPointF &oldPoint, const QPointF &newPoint)
+{
+    const int block = (index + m_offset) / blockSize;
+    if (block < m_blocks.size()) {
+        if (m_blocks.at(block).isInside(oldPoint))
+            m_blocks[block].extend(newPoint);
+        else
+            m_blocks[block].valid = false;
+    }
+    if (m_total.isInside(oldPoint))
+        m_total.extend(newPoint);
+    else
+        m_total.valid = false;
+}
+
+// Updates the bounds for count points removed from index, leaving newCount points.
+void XYPointBounds::remove(int index, int count, int newCount)
+{
+    if (newCount == 0) {
+        reset(0);
+        return;
+    }
+    m_total.valid = false;
+    if (index == 0) {
+        // Drop the blocks that were removed entirely, the first remaining one is partial
+        m_offset += count;
+        const int droppedBlocks = qMin(m_offset / blockSize, m_blocks.size());
+        m_blocks.remove(0, droppedBlocks);
+        m_offset -= droppedBlocks * blockSize;
+        if (m_offset > 0 && !m_blocks.isEmpty())
+            m_blocks[0].valid = false;
+    } else {
+        invalidateBlocks(index);
+    }
+    resizeBlocks(newCount);
+}
+
+void XYPointBounds::reset(int count)
+{
+    m_offset = 0;
+    m_blocks.fill(Bounds(), (count + blockSize - 1) / blockSize);
+    m_total = Bounds();
+}
+
+// Sets rect to the bounds of all points. Returns false and leaves rect untouched if there are no
+// points.
+bool XYPointBounds::bounds(const QVector<QPointF> &points, QRectF *rect)
+{
+    if (points.isEmpty())
+        return false;
+    if (!m_total.valid) {
+        resizeBlocks(points.size());
+        Bounds total;
+        for (int i = 0; i < m_blocks.size(); i++)
+            total.extend(block(points, i));
+        m_total = total;
+    }
+    *rect = m_total.toRect();
+    return true;
+}
+
+// Sets rect to the bounds of the points from index from to index to. Returns false and leaves
+// rect untouched if there are no such points.
+bool XYPointBounds::bounds(const QVector<QPointF> &points, int from, int to, QRectF *rect)
+{
+    from = qMax(0, from);
+    to = qMin(to, points.size());
+    resizeBlocks(points.size());
+    Bounds range;
+    int i = from;
+    while (i < to) {
+        const int blockIndex = (i + m_offset) / blockSize;
+        const int blockStart = blockIndex * blockSize - m_offset;
+        const int blockEnd = blockStart + blockSize;
+        if (i == blockStart && blockEnd <= to) {
+            range.extend(block(points, blockIndex));
+            i = blockEnd;
+        } else {
+            const int end = qMin(to, blockEnd);
+            for (; i < end; i++)
+                range.extend(points.at(i));
+        }
+    }
+    if (!range.valid)
+        return false;
+    *rect = range.toRect();
+    return true;
+}
+
+void XYPointBounds::resizeBlocks(int count)
+{
+    m_blocks.resize((count + m_offset + blockSize - 1) / blockSize);
+}
+
+void XYPointBounds::invalidateBlocks(int index)
+{
+    for (int i = qMax(0, (index + m_offset) / blockSize); i < m_blocks.size(); i++)
+        m_blocks[i].valid = false;
+}
+
+const XYPointBounds::Bounds &XYPointBounds::block(const QVector<QPointF> &points, int block)
+{
+    Bounds &bounds = m_blocks[block];
+    if (!bounds.valid) {
+        const int from = qMax(0, block * blockSize - m_offset);
+        const int to = qMin(points.size(), (block + 1) * blockSize - m_offset);
+        for (int i = from; i < to; i++)
+            bounds.extend(points.at(i));
+    }
+    return bounds;
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYPOINTBOUNDS_H
+#define XYPOINTBOUNDS_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QVector>
+#include <QtCore/QRectF>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Minimum and maximum values of the points of a series, kept for the whole series and for
+// blocks of consecutive points. Appends extend the bounds in constant time. Other changes
+// invalidate the affected blocks, which are recalculated on the next query, so a query costs
+// at most a pass over the blocks instead of over the points.
+// Blocks are aligned to the index of a point plus m_offset, so that dropping the first points
+// of the series only invalidates the first block.
+class XYPointBounds
+{
+public:
+    XYPointBounds();
+
+    void append(const QVector<QPointF> &points, int from);
+    void insert(const QVector<QPointF> &points, int index, int count);
+    void replace(int index, const QPointF &oldPoint, const QPointF &newPoint);
+    void remove(int index, int count, int newCount);
+    void reset(int count);
+
+    bool bounds(const QVector<QPointF> &points, QRectF *rect);
+    bool bounds(const QVector<QPointF> &points, int from, int to, QRectF *rect);
+
+private:
+    struct Bounds {
+        Bounds() : minX(0), maxX(0), minY(0), maxY(0), valid(false) {}
+        void set(const QPointF &point);
+        void extend(const QPointF &point);
+        void extend(const Bounds &bounds);
+        bool isInside(const QPointF &point) const;
+        QRectF toRect() const;
+        qreal minX;
+        qreal maxX;
+        qreal minY;
+        qreal maxY;
+        bool valid;
+    };
+
+    void resizeBlocks(int count);
+    void invalidateBlocks(int index);
+    const Bounds &block(const QVector<QPointF> &points, int block);
+
+    QVector<Bounds> m_blocks;
+    Bounds m_total;
+    int m_offset;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYPOINTBOUNDS_H
@@ -0,0 +1,228 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/xypointindex_p.h>
+#include <QtCore/QtMath>
+#include <limits>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// The grid has about one cell for every two points
+static const int pointsPerCell = 2;
+
+static inline void considerPoint(const QVector<QPointF> &points, int index, const QPointF &value,
+                                 qreal scaleX, qreal scaleY, int *best, qreal *bestDistance)
+{
+    if (index < 0 || index >= points.size())
+        return;
+    const qreal dx = (points.at(index).x() - value.x()) * scaleX;
+    const qreal dy = (points.at(index).y() - value.y()) * scaleY;
+    const qreal distance = dx * dx + dy * dy;
+    // Ties go to the first point
+    if (distance < *bestDistance
+            || (distance == *bestDistance && (*best < 0 || index < *best))) {
+        *best = index;
+        *bestDistance = distance;
+    }
+}
+
+XYPointIndex::XYPointIndex()
+    : m_valid(false),
+      m_minX(0),
+      m_minY(0),
+      m_maxX(0),
+      m_maxY(0),
+      m_cellWidth(1),
+      m_cellHeight(1),
+      m_columns(1),
+      m_rows(1),
+      m_count(0),
+      m_baseId(0),
+      m_firstId(0)
+{
+}
+
+// Adds the points from index from onwards, which were appended to the series.
+void XYPointIndex::append(const QVector<QPointF> &points, int from)
+{
+    if (!m_valid)
+        return;
+    if (from != m_count || m_firstId + from - m_baseId != m_next.size()) {
+        invalidate();
+        return;
+    }
+    for (int i = from; i < points.size(); i++)
+        insert(points.at(i), m_firstId + i);
+    m_count = points.size();
+    if (m_outliers.size() > 32 + m_count / 8)
+        invalidate();
+}
+
+void XYPointIndex::removeFirst(int count)
+{
+    if (!m_valid)
+        return;
+    m_firstId += count;
+    m_count -= count;
+    if (m_firstId - m_baseId > m_count)
+        invalidate();
+}
+
+// Returns the index of the point nearest to value, or -1 if there is no point within
+// maxDistance. The distances along the axes are multiplied by scaleX and scaleY. A negative
+// maxDistance means no limit.
+int XYPointIndex::nearest(const QVector<QPointF> &points, const QPointF &value, qreal scaleX,
+                          qreal scaleY, qreal maxDistance)
+{
+    if (!m_valid || m_count != points.size())
+        build(points);
+
+    int best = -1;
+    qreal bestDistance = maxDistance < 0 ? std::numeric_limits<qreal>::infinity()
+                                         : maxDistance * maxDistance;
+    if (points.isEmpty() || !qIsFinite(value.x()) || !qIsFinite(value.y()))
+        return best;
+
+    // Visit the cells in rings around the cell of value, until the rings are further away
+    // than the nearest point found so far.
+    const int column = qBound(0, qFloor((value.x() - m_minX) / m_cellWidth), m_columns - 1);
+    const int row = qBound(0, qFloor((value.y() - m_minY) / m_cellHeight), m_rows - 1);
+    const qreal ringWidth = qMin(m_cellWidth * qAbs(scaleX), m_cellHeight * qAbs(scaleY));
+    const int maxRing = qMax(m_columns, m_rows);
+    for (int ring = 0; ring <= maxRing; ring++) {
+        if (ring > 0) {
+            const qreal ringDistance = (ring - 1) * ringWidth;
+            if (ringDistance * ringDistance > bestDistance)
+                break;
+        }
+        const int firstRow = qMax(0, row - ring);
+        const int lastRow = qMin(m_rows - 1, row + ring);
+        const int firstColumn = qMax(0, column - ring);
+        const int lastColumn = qMin(m_columns - 1, column + ring);
+        for (int r = firstRow; r <= lastRow; r++) {
+            const bool edgeRow = (r == row - ring || r == row + ring);
+            for (int c = firstColumn; c <= lastColumn; c++) {
+                if (!edgeRow && c != column - ring && c != column + ring) {
+                    // Skip the inside of the ring
+                    if (column + ring > lastColumn)
+                        break;
+                    c = column + ring;
+                }
+                for (int id = m_cellHeads.at(r * m_columns + c); id >= 0;
+                     id = m_next.at(id - m_baseId)) {
+                    considerPoint(points, id - m_firstId, value, scaleX, scaleY, &best,
+                                  &bestDistance);
+                }
+            }
+        }
+    }
+    foreach (int id, m_outliers)
+        considerPoint(points, id - m_firstId, value, scaleX, scaleY, &best, &bestDistance);
+
+    return best;
+}
+
+void XYPointIndex::build(const QVector<QPointF> &points)
+{
+    m_count = points.size();
+    m_baseId = 0;
+    m_firstId = 0;
+    m_outliers.clear();
+
+    bool first = true;
+    foreach (const QPointF &point, points) {
+        if (!qIsFinite(point.x()) || !qIsFinite(point.y()))
+            continue;
+        if (first) {
+            m_minX = m_maxX = point.x();
+            m_minY = m_maxY = point.y();
+            first = false;
+        } else {
+            m_minX = qMin(m_minX, point.x());
+            m_maxX = qMax(m_maxX, point.x());
+            m_minY = qMin(m_minY, point.y());
+            m_maxY = qMax(m_maxY, point.y());
+        }
+    }
+
+    // Shape the cells after the bounds of the points
+    const qreal width = m_maxX - m_minX;
+    const qreal height = m_maxY - m_minY;
+    const int cellCount = qMax(1, m_count / pointsPerCell);
+    if (width > 0 && height > 0) {
+        m_columns = qBound(1, qRound(qSqrt(cellCount * width / height)), cellCount);
+        m_rows = qMax(1, cellCount / m_columns);
+    } else if (width > 0) {
+        m_columns = cellCount;
+        m_rows = 1;
+    } else {
+        m_columns = 1;
+        m_rows = height > 0 ? cellCount : 1;
+    }
+    m_cellWidth = width > 0 ? width / m_columns : 1.0;
+    m_cellHeight = height > 0 ? height / m_rows : 1.0;
+
+    m_cellHeads.fill(-1, m_columns * m_rows);
+    m_next.resize(0);
+    m_next.reserve(m_count);
+    for (int i = 0; i < m_count; i++)
+        insert(points.at(i), i);
+    m_valid = true;
+}
+
+void XYPointIndex::insert(const QPointF &point, int id)
+{
+    // Points with non-finite coordinates are never the nearest, so they are left out
+    if (!qIsFinite(point.x()) || !qIsFinite(point.y())) {
+        m_next.append(-1);
+        return;
+    }
+    const int cell = cellAt(point);
+    if (cell < 0) {
+        m_outliers.append(id);
+        m_next.append(-1);
+    } else {
+        m_next.append(m_cellHeads.at(cell));
+        m_cellHeads[cell] = id;
+    }
+}
+
+// Returns the cell of point, or -1 if the point is outside the grid.
+int XYPointIndex::cellAt(const QPointF &point) const
+{
+    if (!(point.x() >= m_minX && point.x() <= m_maxX && point.y() >= m_minY
+          && point.y() <= m_maxY)) {
+        return -1;
+    }
+    const int column = qMin(m_columns - 1, int((point.x() - m_minX) / m_cellWidth));
+    const int row = qMin(m_rows - 1, int((point.y() - m_minY) / m_cellHeight));
+    return row * m_columns + column;
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,89 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYPOINTINDEX_H
+#define XYPOINTINDEX_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCore/QVector>
+#include <QtCore/QPointF>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Uniform grid of the points of a series for nearest point queries. Each cell links the points
+// in it through m_next, so that appended points are added in constant time. Points are
+// identified by ids that grow with appends, so dropping the first points of the series only
+// moves the id of the first point. The grid is rebuilt on the next query once too many ids are
+// stale or too many points fall outside the grid.
+class XYPointIndex
+{
+public:
+    XYPointIndex();
+
+    void invalidate() { m_valid = false; }
+    void append(const QVector<QPointF> &points, int from);
+    void removeFirst(int count);
+
+    int nearest(const QVector<QPointF> &points, const QPointF &value, qreal scaleX,
+                qreal scaleY, qreal maxDistance);
+
+private:
+    void build(const QVector<QPointF> &points);
+    void insert(const QPointF &point, int id);
+    int cellAt(const QPointF &point) const;
+
+    bool m_valid;
+    qreal m_minX;
+    qreal m_minY;
+    qreal m_maxX;
+    qreal m_maxY;
+    qreal m_cellWidth;
+    qreal m_cellHeight;
+    int m_columns;
+    int m_rows;
+    int m_count;
+    int m_baseId;
+    int m_firstId;
+    QVector<int> m_cellHeads;
+    QVector<int> m_next;
+    QVector<int> m_outliers;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYPOINTINDEX_H
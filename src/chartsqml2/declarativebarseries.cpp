@@ -74,8 +74,7 @@ QVariantList DeclarativeBarSet::values()
 
 void DeclarativeBarSet::setValues(QVariantList values)
 {
-    while (count())
-        remove(count() - 1);
+    remove(0, count());
 
     if (values.count() > 0 && values.at(0).canConvert(QVariant::Point)) {
         // Create list of values for appending if the first item is Qt.point
@@ -87,7 +86,7 @@ void DeclarativeBarSet::setValues(QVariantList values)
             }
         }
 
-        QVector<int> indexValueList;
+        QVector<qreal> indexValueList;
         indexValueList.resize(maxValue + 1);
 
         for (int i = 0; i < values.count(); i++) {
@@ -96,14 +95,16 @@ void DeclarativeBarSet::setValues(QVariantList values)
             }
         }
 
-        for (int i = 0; i < indexValueList.count(); i++)
-            QBarSet::append(indexValueList.at(i));
+        QBarSet::append(indexValueList);
 
     } else {
+        QVector<qreal> valueList;
+        valueList.reserve(values.count());
         for (int i(0); i < values.count(); i++) {
             if (values.at(i).canConvert(QVariant::Double))
-                QBarSet::append(values[i].toDouble());
+                valueList.append(values[i].toDouble());
         }
+        QBarSet::append(valueList);
     }
 }
 
@@ -52,11 +52,16 @@ void DeclarativeXySeries::componentComplete()
     QXYSeries *series = qobject_cast<QXYSeries *>(xySeries());
     Q_ASSERT(series);
 
+    // Add the declared points in one go, so that the chart is updated only once
+    QList<QPointF> points;
     foreach (QObject *child, series->children()) {
-        if (qobject_cast<DeclarativeXYPoint *>(child)) {
-            DeclarativeXYPoint *point = qobject_cast<DeclarativeXYPoint *>(child);
-            series->append(point->x(), point->y());
-        } else if (qobject_cast<QVXYModelMapper *>(child)) {
+        if (DeclarativeXYPoint *point = qobject_cast<DeclarativeXYPoint *>(child))
+            points.append(QPointF(point->x(), point->y()));
+    }
+    series->append(points);
+
+    foreach (QObject *child, series->children()) {
+        if (qobject_cast<QVXYModelMapper *>(child)) {
             QVXYModelMapper *mapper = qobject_cast<QVXYModelMapper *>(child);
             mapper->setSeries(series);
         } else if (qobject_cast<QHXYModelMapper *>(child)) {
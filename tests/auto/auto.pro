@@ -13,6 +13,7 @@ SUBDIRS += \
            qscatterseries \
            qxymodelmapper \
            qbarmodelmapper \
+           qboxplotmodelmapper \
            qhorizontalbarseries \
            qhorizontalstackedbarseries \
            qhorizontalpercentbarseries \
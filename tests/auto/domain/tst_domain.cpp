@@ -28,6 +28,7 @@
 ****************************************************************************/
 #include <QtTest/QtTest>
 #include <private/xydomain_p.h>
+#include <private/logxlogydomain_p.h>
 #include <private/qabstractaxis_p.h>
 #include <tst_definitions.h>
 
@@ -128,6 +129,9 @@ private Q_SLOTS:
     void zoomOut();
     void move_data();
     void move();
+    void calculateGeometryPoints_data();
+    void calculateGeometryPoints();
+    void calculateGeometryPointsLog();
 };
 
 void tst_Domain::initTestCase()
@@ -728,5 +732,74 @@ void tst_Domain::move()
     TRY_COMPARE(spy2.count(), (dy != 0 ? 1 : 0));
 }
 
+void tst_Domain::calculateGeometryPoints_data()
+{
+    QTest::addColumn<QMargins>("range");
+    QTest::addColumn<QSizeF>("size");
+
+    QTest::newRow("unit") << QMargins(0, 0, 1000, 1000) << QSizeF(1000, 1000);
+    QTest::newRow("scaled") << QMargins(-50, 10, 150, 30) << QSizeF(640, 480);
+}
+
+void tst_Domain::calculateGeometryPoints()
+{
+    QFETCH(QMargins, range);
+    QFETCH(QSizeF, size);
+
+    XYDomain domain;
+    domain.setRange(range.left(), range.right(), range.top(), range.bottom());
+    domain.setSize(size);
+
+    QVector<QPointF> points;
+    for (int i = 0; i < 101; i++)
+        points << QPointF(i * 2.5 - 50, qreal(i % 13) - 6);
+
+    QVector<QPointF> result = domain.calculateGeometryPoints(points);
+    QCOMPARE(result.size(), points.size());
+
+    QVector<QPointF> buffer(points.size());
+    QVector<bool> valid(points.size());
+    QCOMPARE(domain.calculateGeometryPoints(points.constData(), points.size(), buffer.data(),
+                                            valid.data()), 0);
+
+    for (int i = 0; i < points.size(); i++) {
+        bool ok;
+        QPointF point = domain.calculateGeometryPoint(points.at(i), ok);
+        QVERIFY(ok);
+        QVERIFY(valid.at(i));
+        QCOMPARE(result.at(i), point);
+        QCOMPARE(buffer.at(i), point);
+    }
+}
+
+void tst_Domain::calculateGeometryPointsLog()
+{
+    LogXLogYDomain domain;
+    domain.setRange(1, 1000, 1, 100);
+    domain.setSize(QSizeF(300, 200));
+
+    QVector<QPointF> points;
+    points << QPointF(1, 1) << QPointF(10, 10) << QPointF(0, 10) << QPointF(100, -1)
+           << QPointF(1000, 100);
+
+    QVector<QPointF> buffer(points.size());
+    QVector<bool> valid(points.size());
+    // Invalid points are flagged, the rest are still mapped
+    QCOMPARE(domain.calculateGeometryPoints(points.constData(), points.size(), buffer.data(),
+                                            valid.data()), 2);
+    QVERIFY(valid.at(0));
+    QVERIFY(valid.at(1));
+    QVERIFY(!valid.at(2));
+    QVERIFY(!valid.at(3));
+    QVERIFY(valid.at(4));
+    QCOMPARE(buffer.at(0), QPointF(0, 200));
+    QCOMPARE(buffer.at(1), QPointF(100, 100));
+    QCOMPARE(buffer.at(4), QPointF(300, 0));
+
+    // The vector version refuses to lay out invalid points
+    QTest::ignoreMessage(QtWarningMsg, "Logarithms of zero and negative values are undefined.");
+    QVERIFY(domain.calculateGeometryPoints(points).isEmpty());
+}
+
 QTEST_MAIN(tst_Domain)
 #include "tst_domain.moc"
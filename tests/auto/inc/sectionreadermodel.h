@@ -0,0 +1,69 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef SECTIONREADERMODEL_H
+#define SECTIONREADERMODEL_H
+
+#include <QtCharts/QModelSectionReader>
+#include <QtGui/QStandardItemModel>
+
+// A model that hands its sections to the model mappers through QModelSectionReader. The reader
+// can be told to decline, in which case the mappers fall back to QAbstractItemModel::data().
+class SectionReaderModel : public QStandardItemModel, public QtCharts::QModelSectionReader
+{
+    Q_OBJECT
+    Q_INTERFACES(QtCharts::QModelSectionReader)
+
+public:
+    SectionReaderModel(int rows, int columns, QObject *parent = 0)
+        : QStandardItemModel(rows, columns, parent),
+          readCount(0),
+          declined(false)
+    {
+    }
+
+    bool readSection(Qt::Orientation orientation, int section, int first, int count,
+                     qreal *values, int stride) const
+    {
+        readCount++;
+        if (declined)
+            return false;
+        for (int i = 0; i < count; i++) {
+            const QModelIndex itemIndex = (orientation == Qt::Vertical)
+                    ? index(first + i, section) : index(section, first + i);
+            values[i * stride] = data(itemIndex).toReal();
+        }
+        return true;
+    }
+
+    mutable int readCount;
+    bool declined;
+};
+
+#endif // SECTIONREADERMODEL_H
@@ -4,3 +4,5 @@
 
 SOURCES += \
     tst_qbarmodelmapper.cpp
+
+HEADERS += ../inc/sectionreadermodel.h
@@ -37,6 +37,7 @@
 #include <QtCharts/QVBarModelMapper>
 #include <QtCharts/QHBarModelMapper>
 #include <QtGui/QStandardItemModel>
+#include "sectionreadermodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -72,6 +73,7 @@ class tst_qbarmodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void modelSectionReader();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -628,6 +630,81 @@ void tst_qbarmodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qbarmodelmapper::modelSectionReader()
+{
+    SectionReaderModel *model = new SectionReaderModel(m_modelRowCount, m_modelColumnCount, this);
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; column++)
+            model->setData(model->index(row, column), row * column);
+    }
+
+    // vertical mapper reads the columns of the bar sets
+    QVBarModelMapper *vMapper = new QVBarModelMapper;
+    vMapper->setFirstBarSetColumn(2);
+    vMapper->setLastBarSetColumn(3);
+    vMapper->setSeries(m_series);
+    vMapper->setModel(model);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 2);
+    for (int set = 0; set < 2; set++) {
+        QCOMPARE(m_series->barSets().at(set)->count(), m_modelRowCount);
+        for (int i = 0; i < m_modelRowCount; i++)
+            QCOMPARE(m_series->barSets().at(set)->at(i), qreal(i * (set + 2)));
+    }
+
+    // the read is clamped to the rows of the model
+    model->readCount = 0;
+    vMapper->setFirstRow(6);
+    vMapper->setRowCount(100);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->barSets().at(0)->count(), m_modelRowCount - 6);
+    QCOMPARE(m_series->barSets().at(1)->at(0), qreal(18));
+    vMapper->setRowCount(2);
+    QCOMPARE(m_series->barSets().at(0)->count(), 2);
+
+    // sections the reader declines are read through data()
+    model->declined = true;
+    model->readCount = 0;
+    vMapper->setFirstRow(1);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->barSets().at(0)->count(), 2);
+    QCOMPARE(m_series->barSets().at(0)->at(1), qreal(4));
+    delete vMapper;
+
+    // horizontal mapper reads the rows of the bar sets
+    model->declined = false;
+    model->readCount = 0;
+    QHBarModelMapper *hMapper = new QHBarModelMapper;
+    hMapper->setFirstBarSetRow(2);
+    hMapper->setLastBarSetRow(3);
+    hMapper->setSeries(m_series);
+    hMapper->setModel(model);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 2);
+    for (int set = 0; set < 2; set++) {
+        QCOMPARE(m_series->barSets().at(set)->count(), m_modelColumnCount);
+        for (int i = 0; i < m_modelColumnCount; i++)
+            QCOMPARE(m_series->barSets().at(set)->at(i), qreal(i * (set + 2)));
+    }
+
+    model->readCount = 0;
+    hMapper->setFirstColumn(5);
+    hMapper->setColumnCount(100);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->barSets().at(0)->count(), m_modelColumnCount - 5);
+    QCOMPARE(m_series->barSets().at(0)->at(0), qreal(10));
+
+    model->declined = true;
+    model->readCount = 0;
+    hMapper->setFirstColumn(4);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->barSets().at(0)->count(), m_modelColumnCount - 4);
+    QCOMPARE(m_series->barSets().at(1)->at(0), qreal(12));
+
+    delete hMapper;
+    delete model;
+}
+
 void tst_qbarmodelmapper::verticalMapperSignals()
 {
     QVBarModelMapper *mapper = new QVBarModelMapper;
@@ -54,12 +54,15 @@ private slots:
     void append();
     void appendOperator_data();
     void appendOperator();
+    void appendVector_data();
+    void appendVector();
     void insert_data();
     void insert();
     void remove_data();
     void remove();
     void replace_data();
     void replace();
+    void replaceRange();
     void at_data();
     void at();
     void atOperator_data();
@@ -188,6 +191,38 @@ void tst_QBarSet::appendOperator()
     QCOMPARE(valueSpy.count(), count);
 }
 
+void tst_QBarSet::appendVector_data()
+{
+    append_data();
+}
+
+void tst_QBarSet::appendVector()
+{
+    QFETCH(int, count);
+
+    QSignalSpy valueSpy(m_barset, SIGNAL(valuesAdded(int,int)));
+
+    m_barset->append(1.0);
+    QVector<qreal> values;
+    qreal sum(1.0);
+    for (int i = 0; i < count; i++) {
+        values.append(i);
+        sum += i;
+    }
+    m_barset->append(values);
+
+    QCOMPARE(m_barset->count(), count + 1);
+    QVERIFY(qFuzzyCompare(m_barset->sum(), sum));
+    for (int i = 0; i < count; i++)
+        QCOMPARE(m_barset->at(i + 1), qreal(i));
+
+    // One signal for the single value and one for the whole vector
+    QCOMPARE(valueSpy.count(), 2);
+    QList<QVariant> valueSpyArg = valueSpy.at(1);
+    QCOMPARE(valueSpyArg.at(0).toInt(), 1);
+    QCOMPARE(valueSpyArg.at(1).toInt(), count);
+}
+
 void tst_QBarSet::insert_data()
 {
 }
@@ -349,6 +384,44 @@ void tst_QBarSet::replace()
     QVERIFY(valueSpy.count() == 2);
 }
 
+void tst_QBarSet::replaceRange()
+{
+    QSignalSpy valueSpy(m_barset, SIGNAL(valueChanged(int)));
+    QSignalSpy rangeSpy(m_barset, SIGNAL(valuesChanged(int,int)));
+
+    *m_barset << 1.0 << 2.0 << 3.0 << 4.0;
+
+    const qreal values[] = { 5.0, 6.0, 7.0 };
+    m_barset->replace(1, values, 2);    // 1.0 5.0 6.0 4.0
+    QCOMPARE(m_barset->count(), 4);
+    QCOMPARE(m_barset->at(0), 1.0);
+    QCOMPARE(m_barset->at(1), 5.0);
+    QCOMPARE(m_barset->at(2), 6.0);
+    QCOMPARE(m_barset->at(3), 4.0);
+    QCOMPARE(rangeSpy.count(), 1);
+    QList<QVariant> rangeSpyArg = rangeSpy.takeFirst();
+    QCOMPARE(rangeSpyArg.at(0).toInt(), 1);
+    QCOMPARE(rangeSpyArg.at(1).toInt(), 2);
+
+    // Values past the end of the set are ignored
+    m_barset->replace(2, values, 3);    // 1.0 5.0 5.0 6.0
+    QCOMPARE(m_barset->count(), 4);
+    QCOMPARE(m_barset->at(2), 5.0);
+    QCOMPARE(m_barset->at(3), 6.0);
+    QCOMPARE(rangeSpy.count(), 1);
+    rangeSpyArg = rangeSpy.takeFirst();
+    QCOMPARE(rangeSpyArg.at(0).toInt(), 2);
+    QCOMPARE(rangeSpyArg.at(1).toInt(), 2);
+
+    // Illegal indexes
+    m_barset->replace(4, values, 1);
+    m_barset->replace(-1, values, 1);
+    m_barset->replace(0, values, 0);
+    QCOMPARE(m_barset->sum(), 17.0);
+    QCOMPARE(rangeSpy.count(), 0);
+    QCOMPARE(valueSpy.count(), 0);
+}
+
 void tst_QBarSet::at_data()
 {
 
@@ -0,0 +1,10 @@
+!include( ../auto.pri ) {
+    error( "Couldn't find the auto.pri file!" )
+}
+
+SOURCES += \
+    tst_qboxplotmodelmapper.cpp
+
+HEADERS += ../inc/sectionreadermodel.h
+
+HEADERS += ../inc/sectionreadermodel.h
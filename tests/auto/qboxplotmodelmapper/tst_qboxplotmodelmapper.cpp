@@ -0,0 +1,184 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QString>
+#include <QtTest/QtTest>
+
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QBoxPlotSeries>
+#include <QtCharts/QBoxSet>
+#include <QtCharts/QVBoxPlotModelMapper>
+#include <QtCharts/QHBoxPlotModelMapper>
+#include "sectionreadermodel.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_qboxplotmodelmapper : public QObject
+{
+    Q_OBJECT
+
+    public:
+    tst_qboxplotmodelmapper();
+
+    private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+    void modelSectionReader();
+
+    private:
+    SectionReaderModel *m_model;
+    int m_modelRowCount;
+    int m_modelColumnCount;
+
+    QBoxPlotSeries *m_series;
+    QChart *m_chart;
+    QChartView *m_chartView;
+};
+
+tst_qboxplotmodelmapper::tst_qboxplotmodelmapper():
+    m_model(0),
+    m_modelRowCount(10),
+    m_modelColumnCount(8),
+    m_series(0),
+    m_chart(0),
+    m_chartView(0)
+{
+}
+
+void tst_qboxplotmodelmapper::init()
+{
+    m_series = new QBoxPlotSeries;
+    m_chart->addSeries(m_series);
+
+    m_model = new SectionReaderModel(m_modelRowCount, m_modelColumnCount, this);
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; column++) {
+            m_model->setData(m_model->index(row, column), row * column);
+        }
+    }
+}
+
+void tst_qboxplotmodelmapper::cleanup()
+{
+    m_chart->removeSeries(m_series);
+    delete m_series;
+    m_series = 0;
+
+    m_model->clear();
+    m_model->deleteLater();
+    m_model = 0;
+}
+
+void tst_qboxplotmodelmapper::initTestCase()
+{
+    m_chart = new QChart;
+    m_chartView = new QChartView(m_chart);
+    m_chartView->show();
+}
+
+void tst_qboxplotmodelmapper::cleanupTestCase()
+{
+    delete m_chartView;
+    QTest::qWait(1); // Allow final deleteLaters to run
+}
+
+void tst_qboxplotmodelmapper::modelSectionReader()
+{
+    // vertical mapper reads the columns of the box sets, a box set takes up to five values
+    QVBoxPlotModelMapper *vMapper = new QVBoxPlotModelMapper;
+    vMapper->setFirstBoxSetColumn(2);
+    vMapper->setLastBoxSetColumn(3);
+    vMapper->setSeries(m_series);
+    vMapper->setModel(m_model);
+    QVERIFY(m_model->readCount > 0);
+    QCOMPARE(m_series->count(), 2);
+    for (int set = 0; set < 2; set++) {
+        QCOMPARE(m_series->boxSets().at(set)->count(), 5);
+        for (int i = 0; i < 5; i++)
+            QCOMPARE(m_series->boxSets().at(set)->at(i), qreal(i * (set + 2)));
+    }
+
+    // the read is clamped to the rows of the model
+    m_model->readCount = 0;
+    vMapper->setFirstRow(7);
+    vMapper->setRowCount(100);
+    QVERIFY(m_model->readCount > 0);
+    QCOMPARE(m_series->boxSets().at(0)->count(), m_modelRowCount - 7);
+    QCOMPARE(m_series->boxSets().at(0)->at(0), qreal(14));
+    vMapper->setRowCount(2);
+    QCOMPARE(m_series->boxSets().at(0)->count(), 2);
+
+    // sections the reader declines are read through data()
+    m_model->declined = true;
+    m_model->readCount = 0;
+    vMapper->setFirstRow(1);
+    QVERIFY(m_model->readCount > 0);
+    QCOMPARE(m_series->boxSets().at(0)->count(), 2);
+    QCOMPARE(m_series->boxSets().at(0)->at(1), qreal(4));
+    delete vMapper;
+
+    // horizontal mapper reads the rows of the box sets
+    m_model->declined = false;
+    m_model->readCount = 0;
+    QHBoxPlotModelMapper *hMapper = new QHBoxPlotModelMapper;
+    hMapper->setFirstBoxSetRow(2);
+    hMapper->setLastBoxSetRow(3);
+    hMapper->setSeries(m_series);
+    hMapper->setModel(m_model);
+    QVERIFY(m_model->readCount > 0);
+    QCOMPARE(m_series->count(), 2);
+    for (int set = 0; set < 2; set++) {
+        QCOMPARE(m_series->boxSets().at(set)->count(), 5);
+        for (int i = 0; i < 5; i++)
+            QCOMPARE(m_series->boxSets().at(set)->at(i), qreal(i * (set + 2)));
+    }
+
+    m_model->readCount = 0;
+    hMapper->setFirstColumn(5);
+    hMapper->setColumnCount(100);
+    QVERIFY(m_model->readCount > 0);
+    QCOMPARE(m_series->boxSets().at(0)->count(), m_modelColumnCount - 5);
+    QCOMPARE(m_series->boxSets().at(0)->at(0), qreal(10));
+
+    m_model->declined = true;
+    m_model->readCount = 0;
+    hMapper->setFirstColumn(4);
+    QVERIFY(m_model->readCount > 0);
+    QCOMPARE(m_series->boxSets().at(0)->count(), m_modelColumnCount - 4);
+    QCOMPARE(m_series->boxSets().at(1)->at(0), qreal(12));
+
+    delete hMapper;
+}
+
+QTEST_MAIN(tst_qboxplotmodelmapper)
+
+#include "tst_qboxplotmodelmapper.moc"
@@ -3,3 +3,5 @@
 }
 
 SOURCES += tst_qcandlestickmodelmapper.cpp
+
+HEADERS += ../inc/sectionreadermodel.h
@@ -35,6 +35,7 @@
 #include <QtCore/QString>
 #include <QtGui/QStandardItemModel>
 #include <QtTest/QtTest>
+#include "sectionreadermodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -73,6 +74,7 @@ private Q_SLOTS:
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void modelSectionReader();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -553,6 +555,93 @@ void tst_qcandlestickmodelmapper::modelUpdateCell()
     QCOMPARE(m_series->candlestickSets().at(index.row())->timestamp(), newValue);
 }
 
+void tst_qcandlestickmodelmapper::modelSectionReader()
+{
+    SectionReaderModel *model = new SectionReaderModel(m_modelRowCount, m_modelColumnCount, this);
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; ++column)
+            model->setData(model->index(row, column), row * column);
+    }
+
+    // horizontal mapper reads the columns of the values across the rows of the sets
+    QHCandlestickModelMapper *hMapper = new QHCandlestickModelMapper();
+    hMapper->setTimestampColumn(0);
+    hMapper->setOpenColumn(1);
+    hMapper->setHighColumn(3);
+    hMapper->setLowColumn(5);
+    hMapper->setCloseColumn(6);
+    hMapper->setFirstCandlestickSetRow(0);
+    hMapper->setLastCandlestickSetRow(4);
+    hMapper->setSeries(m_series);
+    hMapper->setModel(model);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 5);
+    for (int i = 0; i < m_series->count(); ++i) {
+        QCandlestickSet *set = m_series->candlestickSets().at(i);
+        QCOMPARE(set->timestamp(), 0.0);
+        QCOMPARE(set->open(), qreal(i));
+        QCOMPARE(set->high(), qreal(i * 3));
+        QCOMPARE(set->low(), qreal(i * 5));
+        QCOMPARE(set->close(), qreal(i * 6));
+    }
+
+    // the sets are limited to the rows of the model
+    model->readCount = 0;
+    hMapper->setLastCandlestickSetRow(100);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelRowCount);
+    QCOMPARE(m_series->candlestickSets().last()->close(), qreal((m_modelRowCount - 1) * 6));
+
+    // values the reader declines are read through data()
+    model->declined = true;
+    model->readCount = 0;
+    hMapper->setLastCandlestickSetRow(3);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->candlestickSets().at(3)->high(), qreal(9));
+    QCOMPARE(m_series->candlestickSets().at(3)->close(), qreal(18));
+    delete hMapper;
+
+    // vertical mapper reads the rows of the values across the columns of the sets
+    model->declined = false;
+    model->readCount = 0;
+    QVCandlestickModelMapper *vMapper = new QVCandlestickModelMapper();
+    vMapper->setTimestampRow(0);
+    vMapper->setOpenRow(1);
+    vMapper->setHighRow(3);
+    vMapper->setLowRow(5);
+    vMapper->setCloseRow(6);
+    vMapper->setFirstCandlestickSetColumn(0);
+    vMapper->setLastCandlestickSetColumn(4);
+    vMapper->setSeries(m_series);
+    vMapper->setModel(model);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 5);
+    for (int i = 0; i < m_series->count(); ++i) {
+        QCandlestickSet *set = m_series->candlestickSets().at(i);
+        QCOMPARE(set->timestamp(), 0.0);
+        QCOMPARE(set->open(), qreal(i));
+        QCOMPARE(set->high(), qreal(i * 3));
+        QCOMPARE(set->low(), qreal(i * 5));
+        QCOMPARE(set->close(), qreal(i * 6));
+    }
+
+    model->readCount = 0;
+    vMapper->setLastCandlestickSetColumn(100);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelColumnCount);
+
+    model->declined = true;
+    model->readCount = 0;
+    vMapper->setLastCandlestickSetColumn(3);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->candlestickSets().at(3)->low(), qreal(15));
+
+    delete vMapper;
+    delete model;
+}
+
 void tst_qcandlestickmodelmapper::verticalMapperSignals()
 {
     QVCandlestickModelMapper *mapper = new QVCandlestickModelMapper();
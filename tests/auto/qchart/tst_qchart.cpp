@@ -73,6 +73,8 @@ private slots:
     void animationDuration();
     void animationCurve_data();
     void animationCurve();
+    void animationSuppression();
+    void areaSeriesAppend();
     void axisX_data();
     void axisX();
     void axisY_data();
@@ -176,6 +178,8 @@ void tst_QChart::qchart()
     QCOMPARE(m_chart->animationOptions(), QChart::NoAnimation);
     QCOMPARE(m_chart->animationDuration(), 1000);
     QCOMPARE(m_chart->animationEasingCurve(), QEasingCurve(QEasingCurve::OutQuart));
+    QCOMPARE(m_chart->animationSuppressionInterval(), 0);
+    QCOMPARE(m_chart->animationPointLimit(), 0);
     QVERIFY(!m_chart->axisX());
     QVERIFY(!m_chart->axisY());
     QVERIFY(m_chart->backgroundBrush()!=QBrush());
@@ -298,6 +302,129 @@ void tst_QChart::animationCurve()
     QCOMPARE(m_chart->animationEasingCurve(), animationCurve);
 }
 
+void tst_QChart::animationSuppression()
+{
+    QChartView referenceView(newQChartOrQPolarChart());
+    QChart *referenceChart = referenceView.chart();
+
+    // The reference chart shows the same points as the tested one, but without animations
+    QVector<QPointF> points;
+    QVector<QPointF> otherPoints;
+    for (int i = 0; i <= 20; i++) {
+        points.append(QPointF(i, i % 7));
+        otherPoints.append(QPointF(i, i % 5));
+    }
+    QLineSeries *series = new QLineSeries();
+    QLineSeries *reference = new QLineSeries();
+    series->replace(points);
+    reference->replace(points);
+    m_chart->addSeries(series);
+    referenceChart->addSeries(reference);
+    m_chart->createDefaultAxes();
+    referenceChart->createDefaultAxes();
+    m_chart->axisX(series)->setRange(0, 20);
+    m_chart->axisY(series)->setRange(0, 10);
+    referenceChart->axisX(reference)->setRange(0, 20);
+    referenceChart->axisY(reference)->setRange(0, 10);
+    m_view->resize(400, 300);
+    referenceView.resize(400, 300);
+    m_view->show();
+    referenceView.show();
+    QTest::qWaitForWindowShown(m_view);
+    QTest::qWaitForWindowShown(&referenceView);
+    QVERIFY(m_view->grab().toImage() == referenceView.grab().toImage());
+
+    m_chart->setAnimationOptions(QChart::SeriesAnimations);
+    m_chart->setAnimationDuration(300);
+    m_chart->setAnimationSuppressionInterval(60000);
+    QCOMPARE(m_chart->animationSuppressionInterval(), 60000);
+
+    // A change within the interval of the previous one is shown at once and cancels the
+    // animation of the previous change
+    series->replace(otherPoints);
+    reference->replace(otherPoints);
+    QTest::qWait(50);
+    series->replace(points);
+    reference->replace(points);
+    QVERIFY(m_view->grab().toImage() == referenceView.grab().toImage());
+    QTest::qWait(400);
+    QVERIFY(m_view->grab().toImage() == referenceView.grab().toImage());
+
+    // A change of more points than the limit is shown at once
+    m_chart->setAnimationSuppressionInterval(0);
+    m_chart->setAnimationPointLimit(10);
+    QCOMPARE(m_chart->animationPointLimit(), 10);
+    series->replace(otherPoints);
+    reference->replace(otherPoints);
+    QVERIFY(m_view->grab().toImage() == referenceView.grab().toImage());
+    QTest::qWait(400);
+    QVERIFY(m_view->grab().toImage() == referenceView.grab().toImage());
+
+    // Without the limit the same change is animated
+    m_chart->setAnimationPointLimit(0);
+    series->replace(points);
+    reference->replace(points);
+    QVERIFY(m_view->grab().toImage() != referenceView.grab().toImage());
+    QTRY_VERIFY(m_view->grab().toImage() == referenceView.grab().toImage());
+
+    m_chart->setAnimationSuppressionInterval(-1);
+    QCOMPARE(m_chart->animationSuppressionInterval(), 0);
+    m_chart->setAnimationPointLimit(-1);
+    QCOMPARE(m_chart->animationPointLimit(), 0);
+}
+
+void tst_QChart::areaSeriesAppend()
+{
+    QChartView referenceView(newQChartOrQPolarChart());
+    QChart *referenceChart = referenceView.chart();
+
+    QLineSeries *upper = new QLineSeries();
+    QLineSeries *lower = new QLineSeries();
+    QLineSeries *referenceUpper = new QLineSeries();
+    QLineSeries *referenceLower = new QLineSeries();
+    for (int i = 0; i <= 10; i++) {
+        if (i <= 5) {
+            upper->append(i, 2);
+            lower->append(i, 1);
+        }
+        referenceUpper->append(i, 2);
+        referenceLower->append(i, 1);
+    }
+    QAreaSeries *area = new QAreaSeries(upper, lower);
+    QAreaSeries *reference = new QAreaSeries(referenceUpper, referenceLower);
+    m_chart->addSeries(area);
+    referenceChart->addSeries(reference);
+    area->setPen(Qt::NoPen);
+    area->setBrush(Qt::red);
+    reference->setPen(Qt::NoPen);
+    reference->setBrush(Qt::red);
+    m_chart->createDefaultAxes();
+    referenceChart->createDefaultAxes();
+    m_chart->axisX(area)->setRange(0, 10);
+    m_chart->axisY(area)->setRange(0, 3);
+    referenceChart->axisX(reference)->setRange(0, 10);
+    referenceChart->axisY(reference)->setRange(0, 3);
+    m_view->resize(400, 300);
+    referenceView.resize(400, 300);
+    m_view->show();
+    referenceView.show();
+    QTest::qWaitForWindowShown(m_view);
+    QTest::qWaitForWindowShown(&referenceView);
+
+    const QPointF position = m_chart->mapToPosition(QPointF(8, 1.5), area);
+    const QPoint pixel = m_view->mapFromScene(m_chart->mapToScene(position));
+    QVERIFY(m_view->grab().toImage().pixel(pixel) != QColor(Qt::red).rgb());
+
+    // Appending points to the bounds extends the area
+    for (int i = 6; i <= 10; i++) {
+        upper->append(i, 2);
+        lower->append(i, 1);
+    }
+    const QImage image = m_view->grab().toImage();
+    QCOMPARE(image.pixel(pixel), QColor(Qt::red).rgb());
+    QVERIFY(image == referenceView.grab().toImage());
+}
+
 void tst_QChart::axisX_data()
 {
 
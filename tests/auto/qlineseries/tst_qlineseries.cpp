@@ -48,6 +48,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void pressedSignalAfterAppend();
     void insert();
 protected:
     void pointsVisible_data();
@@ -234,6 +235,39 @@ void tst_QLineSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(linePoint.y()));
 }
 
+void tst_QLineSeries::pressedSignalAfterAppend()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    QLineSeries *lineSeries = new QLineSeries();
+    lineSeries->append(QPointF(0, 0));
+    lineSeries->append(QPointF(10, 10));
+    lineSeries->append(QPointF(20, 0));
+    lineSeries->append(QPointF(20, 10));
+
+    QChartView view;
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(lineSeries);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    QSignalSpy seriesSpy(lineSeries, SIGNAL(pressed(QPointF)));
+
+    QPoint linePoint = view.chart()->mapToPosition(QPointF(5, 5)).toPoint();
+    QPoint segmentPoint = view.chart()->mapToPosition(QPointF(15, 6)).toPoint();
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, linePoint);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, segmentPoint);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 1);
+
+    // The shape used for hit testing covers the appended segment
+    lineSeries->append(QPointF(10, 2));
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, segmentPoint);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 2);
+}
+
 QTEST_MAIN(tst_QLineSeries)
 
 #include "tst_qlineseries.moc"
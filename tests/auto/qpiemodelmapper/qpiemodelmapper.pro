@@ -4,3 +4,5 @@
 
 SOURCES += \
     tst_qpiemodelmapper.cpp
+
+HEADERS += ../inc/sectionreadermodel.h
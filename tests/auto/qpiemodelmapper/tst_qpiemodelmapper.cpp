@@ -37,6 +37,7 @@
 #include <QtCharts/QVPieModelMapper>
 #include <QtCharts/QHPieModelMapper>
 #include <QtGui/QStandardItemModel>
+#include "sectionreadermodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -72,6 +73,7 @@ class tst_qpiemodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void modelSectionReader();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -537,6 +539,75 @@ void tst_qpiemodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qpiemodelmapper::modelSectionReader()
+{
+    SectionReaderModel *model = new SectionReaderModel(m_modelRowCount, m_modelColumnCount, this);
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; column++)
+            model->setData(model->index(row, column), row * column);
+    }
+
+    // vertical mapper reads the values column
+    QVPieModelMapper *vMapper = new QVPieModelMapper;
+    vMapper->setValuesColumn(2);
+    vMapper->setLabelsColumn(1);
+    vMapper->setSeries(m_series);
+    vMapper->setModel(model);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelRowCount);
+    for (int i = 0; i < m_modelRowCount; i++)
+        QCOMPARE(m_series->slices().at(i)->value(), qreal(i * 2));
+
+    // the read is clamped to the rows of the model
+    model->readCount = 0;
+    vMapper->setFirstRow(6);
+    vMapper->setRowCount(100);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelRowCount - 6);
+    QCOMPARE(m_series->slices().at(0)->value(), qreal(12));
+    vMapper->setRowCount(2);
+    QCOMPARE(m_series->count(), 2);
+
+    // sections the reader declines are read through data()
+    model->declined = true;
+    model->readCount = 0;
+    vMapper->setFirstRow(1);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->slices().at(1)->value(), qreal(4));
+    delete vMapper;
+
+    // horizontal mapper reads the values row
+    model->declined = false;
+    model->readCount = 0;
+    QHPieModelMapper *hMapper = new QHPieModelMapper;
+    hMapper->setValuesRow(2);
+    hMapper->setLabelsRow(1);
+    hMapper->setSeries(m_series);
+    hMapper->setModel(model);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelColumnCount);
+    for (int i = 0; i < m_modelColumnCount; i++)
+        QCOMPARE(m_series->slices().at(i)->value(), qreal(i * 2));
+
+    model->readCount = 0;
+    hMapper->setFirstColumn(5);
+    hMapper->setColumnCount(100);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelColumnCount - 5);
+    QCOMPARE(m_series->slices().at(0)->value(), qreal(10));
+
+    model->declined = true;
+    model->readCount = 0;
+    hMapper->setFirstColumn(4);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelColumnCount - 4);
+    QCOMPARE(m_series->slices().at(1)->value(), qreal(10));
+
+    delete hMapper;
+    delete model;
+}
+
 void tst_qpiemodelmapper::verticalMapperSignals()
 {
     QVPieModelMapper *mapper = new QVPieModelMapper;
@@ -49,6 +49,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void batchedPressedSignal();
 
 protected:
     void pointsVisible_data();
@@ -233,6 +234,44 @@ void tst_QScatterSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(scatterPoint.y()));
 }
 
+void tst_QScatterSeries::batchedPressedSignal()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Large series are drawn without marker items, so the markers are hit tested by the series
+    QPointF scatterPoint(4, 12);
+    QScatterSeries *scatterSeries = new QScatterSeries();
+    for (int i = 0; i < 5000; i++)
+        scatterSeries->append(QPointF(i * 0.002, 1));
+    scatterSeries->append(scatterPoint);
+    scatterSeries->append(QPointF(6, 12));
+
+    QChartView view;
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(scatterSeries);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    QSignalSpy pressedSpy(scatterSeries, SIGNAL(pressed(QPointF)));
+    QSignalSpy clickedSpy(scatterSeries, SIGNAL(clicked(QPointF)));
+
+    QPointF checkPoint = view.chart()->mapToPosition(scatterPoint);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QCOMPARE(pressedSpy.count(), 1);
+    QCOMPARE(clickedSpy.count(), 1);
+    QCOMPARE(qvariant_cast<QPointF>(pressedSpy.takeFirst().at(0)), scatterPoint);
+    QCOMPARE(qvariant_cast<QPointF>(clickedSpy.takeFirst().at(0)), scatterPoint);
+
+    // Clicking between the markers does not hit any of them
+    checkPoint = view.chart()->mapToPosition(QPointF(5, 6));
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QCOMPARE(pressedSpy.count(), 0);
+}
+
 QTEST_MAIN(tst_QScatterSeries)
 
 #include "tst_qscatterseries.moc"
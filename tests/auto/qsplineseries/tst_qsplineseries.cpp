@@ -48,6 +48,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void culledGeometry();
 protected:
     void pointsVisible_data();
 };
@@ -205,5 +206,44 @@ void tst_QSplineSeries::doubleClickedSignal()
 }
 QTEST_MAIN(tst_QSplineSeries)
 
+void tst_QSplineSeries::culledGeometry()
+{
+    QSplineSeries *splineSeries = new QSplineSeries();
+    QSplineSeries *referenceSeries = new QSplineSeries();
+    for (int i = 0; i < 200; i++) {
+        splineSeries->append(i, (i * 37) % 11);
+        referenceSeries->append(i, (i * 37) % 11);
+    }
+
+    // Series animations disable culling, so the reference spline is solved from all the points
+    QChartView view;
+    QChartView referenceView;
+    referenceView.chart()->setAnimationOptions(QChart::SeriesAnimations);
+    referenceView.chart()->setAnimationDuration(100);
+    view.chart()->addSeries(splineSeries);
+    referenceView.chart()->addSeries(referenceSeries);
+    view.chart()->createDefaultAxes();
+    referenceView.chart()->createDefaultAxes();
+    view.chart()->axisX(splineSeries)->setRange(50, 60);
+    view.chart()->axisY(splineSeries)->setRange(-5, 15);
+    referenceView.chart()->axisX(referenceSeries)->setRange(50, 60);
+    referenceView.chart()->axisY(referenceSeries)->setRange(-5, 15);
+    view.resize(400, 300);
+    referenceView.resize(400, 300);
+    view.show();
+    referenceView.show();
+    QTest::qWaitForWindowShown(&view);
+    QTest::qWaitForWindowShown(&referenceView);
+    QTest::qWait(300);
+
+    // The segments at the edges of the plot area do not change shape when the points beyond
+    // them are culled
+    QVERIFY(view.grab().toImage() == referenceView.grab().toImage());
+    view.chart()->axisX(splineSeries)->setRange(20, 30);
+    referenceView.chart()->axisX(referenceSeries)->setRange(20, 30);
+    QTest::qWait(300);
+    QVERIFY(view.grab().toImage() == referenceView.grab().toImage());
+}
+
 #include "tst_qsplineseries.moc"
 
@@ -32,6 +32,7 @@
 #include <QtCharts/QBarSet>
 #include <QtCharts/QChartView>
 #include <QtCharts/QChart>
+#include <QtCharts/QValueAxis>
 #include "tst_definitions.h"
 
 QT_CHARTS_USE_NAMESPACE
@@ -57,6 +58,7 @@ private slots:
     void setLabelsFormat();
     void setLabelsPosition();
     void setLabelsAngle();
+    void valuesChangedOutsideChart();
     void mouseclicked_data();
     void mouseclicked();
     void mousehovered_data();
@@ -179,6 +181,37 @@ void tst_QStackedBarSeries::setLabelsAngle()
     QCOMPARE(m_barseries->labelsAngle(), 55.0);
 }
 
+void tst_QStackedBarSeries::valuesChangedOutsideChart()
+{
+    QStackedBarSeries *series = new QStackedBarSeries();
+    QBarSet *set1 = new QBarSet(QString("set 1"));
+    *set1 << 1 << 2 << 3;
+    QBarSet *set2 = new QBarSet(QString("set 2"));
+    *set2 << 4 << 5 << 6;
+    series->append(set1);
+    series->append(set2);
+
+    QChartView view(new QChart());
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    QValueAxis *axis = qobject_cast<QValueAxis *>(view.chart()->axisY(series));
+    QVERIFY(axis);
+    QVERIFY(axis->max() >= 9.0);
+    QVERIFY(axis->max() < 30.0);
+    QVERIFY(axis->min() > -10.0);
+
+    // Values changed while the series is not in a chart must still show up in its range
+    view.chart()->removeSeries(series);
+    set2->replace(1, 25);
+    set1->append(-10);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    axis = qobject_cast<QValueAxis *>(view.chart()->axisY(series));
+    QVERIFY(axis);
+    QVERIFY(axis->max() >= 27.0);
+    QVERIFY(axis->min() <= -10.0);
+}
+
 void tst_QStackedBarSeries::mouseclicked_data()
 {
 
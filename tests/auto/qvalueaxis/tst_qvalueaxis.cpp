@@ -71,6 +71,7 @@ private slots:
     void autoscale_data();
     void autoscale();
     void reverse();
+    void autoFitVisibleRange();
 
 private:
     QValueAxis* m_valuesaxis;
@@ -436,6 +437,48 @@ void tst_QValueAxis::reverse()
     QCOMPARE(m_valuesaxis->isReverse(), true);
 }
 
+void tst_QValueAxis::autoFitVisibleRange()
+{
+    QSignalSpy spy(m_valuesaxis, SIGNAL(autoFitVisibleRangeChanged(bool)));
+    QCOMPARE(m_valuesaxis->autoFitVisibleRange(), false);
+
+    *m_series << QPointF(150, 30) << QPointF(200, 20);
+    m_chart->setAxisY(m_valuesaxis, m_series);
+    m_valuesaxis->setRange(-500, 500);
+
+    m_valuesaxis->setAutoFitVisibleRange(true);
+    QCOMPARE(m_valuesaxis->autoFitVisibleRange(), true);
+    QCOMPARE(spy.count(), 1);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), -100), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 100), "Max not equal");
+
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(m_chart->axisX(m_series));
+    QVERIFY(axisX);
+    axisX->setRange(120, 250);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), 20), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 30), "Max not equal");
+
+    axisX->setRange(180, 250);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), 19.5), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 20.5), "Max not equal");
+
+    // No points in range keeps the previous range
+    axisX->setRange(300, 400);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), 19.5), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 20.5), "Max not equal");
+
+    // A single visible point at the origin is fitted like any other point
+    axisX->setRange(-10, 10);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), -0.5), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 0.5), "Max not equal");
+
+    m_valuesaxis->setAutoFitVisibleRange(false);
+    QCOMPARE(spy.count(), 2);
+    axisX->setRange(-100, 100);
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->min(), -0.5), "Min not equal");
+    QVERIFY2(qFuzzyCompare(m_valuesaxis->max(), 0.5), "Max not equal");
+}
+
 QTEST_MAIN(tst_QValueAxis)
 #include "tst_qvalueaxis.moc"
 
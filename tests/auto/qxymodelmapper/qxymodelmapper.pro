@@ -4,3 +4,5 @@
 
 SOURCES += \
     tst_qxymodelmapper.cpp
+
+HEADERS += ../inc/sectionreadermodel.h
@@ -38,6 +38,7 @@
 #include <QtCharts/QHXYModelMapper>
 #include <QtGui/QStandardItemModel>
 #include "tst_definitions.h"
+#include "sectionreadermodel.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -73,6 +74,8 @@ class tst_qxymodelmapper : public QObject
     void horizontalModelInsertColumns();
     void horizontalModelRemoveColumns();
     void modelUpdateCell();
+    void modelUpdateRange();
+    void modelSectionReader();
     void verticalMapperSignals();
     void horizontalMapperSignals();
 
@@ -347,6 +350,10 @@ void tst_qxymodelmapper::seriesUpdated()
     m_series->replace(m_series->points().first(), QPointF(25.0, 75.0));
     QCOMPARE(m_model->data(m_model->index(0, 0)).toReal(), 25.0);
     QCOMPARE(m_model->data(m_model->index(0, 1)).toReal(), 75.0);
+
+    m_series->replacePoints(1, QVector<QPointF>() << QPointF(26.0, 76.0) << QPointF(27.0, 77.0));
+    QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 26.0);
+    QCOMPARE(m_model->data(m_model->index(2, 1)).toReal(), 77.0);
 }
 
 void tst_qxymodelmapper::verticalModelInsertRows()
@@ -543,6 +550,77 @@ void tst_qxymodelmapper::modelUpdateCell()
     QCOMPARE(m_model->data(m_model->index(1, 0)).toReal(), 44.0);
 }
 
+void tst_qxymodelmapper::modelUpdateRange()
+{
+    // setup the mapper
+    createVerticalMapper();
+    m_vMapper->setFirstRow(2);
+    m_vMapper->setRowCount(5);
+    QCOMPARE(m_series->count(), 5);
+
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointReplaced(int)));
+    QSignalSpy rangeSpy(m_series, SIGNAL(pointRangeReplaced(int,int)));
+
+    m_model->blockSignals(true);
+    for (int row = 0; row < m_modelRowCount; row++) {
+        m_model->setData(m_model->index(row, 0), row + 100);
+        m_model->setData(m_model->index(row, 1), row + 200);
+    }
+    m_model->blockSignals(false);
+
+    // Changes to columns that are not mapped are ignored
+    emit m_model->dataChanged(m_model->index(0, 2), m_model->index(m_modelRowCount - 1, 3));
+    QCOMPARE(rangeSpy.count(), 0);
+
+    // The mapped rows of the change are replaced at once
+    emit m_model->dataChanged(m_model->index(0, 0), m_model->index(m_modelRowCount - 1, 1));
+    QCOMPARE(replacedSpy.count(), 0);
+    QCOMPARE(rangeSpy.count(), 1);
+    QList<QVariant> arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 0);
+    QCOMPARE(arguments.at(1).toInt(), 5);
+    for (int i = 0; i < m_series->count(); i++)
+        QCOMPARE(m_series->at(i), QPointF(i + 102, i + 202));
+}
+
+void tst_qxymodelmapper::modelSectionReader()
+{
+    SectionReaderModel *model = new SectionReaderModel(m_modelRowCount, m_modelColumnCount, this);
+    for (int row = 0; row < m_modelRowCount; ++row) {
+        for (int column = 0; column < m_modelColumnCount; column++)
+            model->setData(model->index(row, column), row * column);
+    }
+
+    QVXYModelMapper *mapper = new QVXYModelMapper;
+    mapper->setXColumn(2);
+    mapper->setYColumn(3);
+    mapper->setSeries(m_series);
+    mapper->setModel(model);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), m_modelRowCount);
+    for (int i = 0; i < m_series->count(); i++)
+        QCOMPARE(m_series->at(i), QPointF(i * 2, i * 3));
+
+    model->readCount = 0;
+    mapper->setFirstRow(3);
+    mapper->setRowCount(4);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->at(0), QPointF(6, 9));
+    QCOMPARE(m_series->at(3), QPointF(12, 18));
+
+    // Values the reader declines to read are read through data()
+    model->declined = true;
+    model->readCount = 0;
+    mapper->setFirstRow(0);
+    QVERIFY(model->readCount > 0);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->at(3), QPointF(6, 9));
+
+    delete mapper;
+    delete model;
+}
+
 void tst_qxymodelmapper::verticalMapperSignals()
 {
     QVXYModelMapper *mapper = new QVXYModelMapper;
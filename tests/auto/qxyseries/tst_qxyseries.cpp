@@ -30,6 +30,7 @@
 #include "tst_qxyseries.h"
 
 Q_DECLARE_METATYPE(QList<QPointF>)
+Q_DECLARE_METATYPE(QXYSeries::DecimationMode)
 
 void tst_QXYSeries::initTestCase()
 {
@@ -42,6 +43,7 @@ void tst_QXYSeries::cleanupTestCase()
 
 void tst_QXYSeries::init()
 {
+    qRegisterMetaType<QXYSeries::DecimationMode>("QXYSeries::DecimationMode");
     m_view = new QChartView(newQChartOrQPolarChart());
     m_chart = m_view->chart();
 }
@@ -205,9 +207,15 @@ void tst_QXYSeries::append_raw()
     QFETCH(QList<QPointF>, otherPoints);
     QSignalSpy spy0(m_series, SIGNAL(clicked(QPointF)));
     QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy rangeSpy(m_series, SIGNAL(pointsAdded(int,int)));
     m_series->append(points);
     TRY_COMPARE(spy0.count(), 0);
-    TRY_COMPARE(addedSpy.count(), points.count());
+    // The whole list is reported as one batch
+    TRY_COMPARE(addedSpy.count(), 0);
+    TRY_COMPARE(rangeSpy.count(), 1);
+    QList<QVariant> arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 0);
+    QCOMPARE(arguments.at(1).toInt(), points.count());
     QCOMPARE(m_series->points(), points);
     QCOMPARE(m_series->pointsVector(), points.toVector());
 
@@ -652,3 +660,445 @@ void tst_QXYSeries::changedSignals()
     TRY_COMPARE(nameSpy.count(), 0);
     TRY_COMPARE(colorSpy.count(), 2);
 }
+
+void tst_QXYSeries::maximumPointCount_raw()
+{
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy removedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+    QSignalSpy shiftedSpy(m_series, SIGNAL(pointsShifted(int,int)));
+    QSignalSpy countSpy(m_series, SIGNAL(maximumPointCountChanged(int)));
+
+    QCOMPARE(m_series->maximumPointCount(), 0);
+    m_series->setMaximumPointCount(3);
+    m_series->setMaximumPointCount(3);
+    QCOMPARE(m_series->maximumPointCount(), 3);
+    QCOMPARE(countSpy.count(), 1);
+
+    for (int i = 0; i < 5; i++)
+        m_series->append(i, i);
+
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(m_series->at(0), QPointF(2, 2));
+    QCOMPARE(m_series->at(2), QPointF(4, 4));
+    QCOMPARE(addedSpy.count(), 3);
+    QCOMPARE(shiftedSpy.count(), 2);
+    QList<QVariant> arguments = shiftedSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 1);
+    QCOMPARE(arguments.at(1).toInt(), 1);
+    QCOMPARE(removedSpy.count(), 0);
+
+    // Lowering the limit drops the oldest points
+    m_series->setMaximumPointCount(2);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->at(0), QPointF(3, 3));
+
+    // Replace keeps the last points
+    QVector<QPointF> points;
+    points << QPointF(10, 10) << QPointF(11, 11) << QPointF(12, 12);
+    m_series->replace(points);
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->at(0), QPointF(11, 11));
+
+    // Zero means no limit
+    m_series->setMaximumPointCount(0);
+    m_series->append(13, 13);
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(shiftedSpy.count(), 1);
+}
+
+void tst_QXYSeries::maximumPointCount_chart()
+{
+    m_view->show();
+    m_chart->addSeries(m_series);
+    QTest::qWaitForWindowShown(m_view);
+    maximumPointCount_raw();
+}
+
+void tst_QXYSeries::decimationMode_raw()
+{
+    QSignalSpy modeSpy(m_series, SIGNAL(decimationModeChanged(QXYSeries::DecimationMode)));
+    QCOMPARE(m_series->decimationMode(), QXYSeries::DecimationNone);
+
+    m_series->setDecimationMode(QXYSeries::DecimationMinMax);
+    m_series->setDecimationMode(QXYSeries::DecimationMinMax);
+    QCOMPARE(m_series->decimationMode(), QXYSeries::DecimationMinMax);
+    TRY_COMPARE(modeSpy.count(), 1);
+    QList<QVariant> arguments = modeSpy.takeFirst();
+    QVERIFY(arguments.at(0).value<QXYSeries::DecimationMode>() == QXYSeries::DecimationMinMax);
+
+    // Decimation only affects drawing, the series keeps all its points
+    for (int i = 0; i < 10000; i++)
+        m_series->append(i, i % 7);
+    QCOMPARE(m_series->count(), 10000);
+    QCOMPARE(m_series->at(9999), QPointF(9999, 9999 % 7));
+
+    m_series->setDecimationMode(QXYSeries::DecimationNone);
+    QCOMPARE(m_series->decimationMode(), QXYSeries::DecimationNone);
+    TRY_COMPARE(modeSpy.count(), 1);
+}
+
+void tst_QXYSeries::decimationMode_chart()
+{
+    m_view->show();
+    m_chart->addSeries(m_series);
+    QTest::qWaitForWindowShown(m_view);
+    decimationMode_raw();
+}
+
+void tst_QXYSeries::appendRange_raw()
+{
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy rangeSpy(m_series, SIGNAL(pointsAdded(int,int)));
+    QSignalSpy shiftedSpy(m_series, SIGNAL(pointsShifted(int,int)));
+
+    const qreal x[] = { 0, 1, 2, 3 };
+    const qreal y[] = { 10, 11, qQNaN(), 13 };
+    m_series->appendRange(x, y, 4);
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(m_series->at(2), QPointF(3, 13));
+    QCOMPARE(addedSpy.count(), 0);
+    QCOMPARE(rangeSpy.count(), 1);
+    QList<QVariant> arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 0);
+    QCOMPARE(arguments.at(1).toInt(), 3);
+
+    // Interleaved x, y, z records
+    const qreal xyz[] = { 4, 14, -1, 5, 15, -1 };
+    m_series->appendRange(xyz, xyz + 1, 2, 3, 3);
+    QCOMPARE(m_series->count(), 5);
+    QCOMPARE(m_series->at(3), QPointF(4, 14));
+    QCOMPARE(m_series->at(4), QPointF(5, 15));
+    QCOMPARE(rangeSpy.count(), 1);
+    arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 3);
+    QCOMPARE(arguments.at(1).toInt(), 2);
+
+    m_series->setMaximumPointCount(6);
+    m_series->appendRange(x, y, 2);
+    QCOMPARE(m_series->count(), 6);
+    QCOMPARE(m_series->at(0), QPointF(1, 11));
+    QCOMPARE(m_series->at(5), QPointF(1, 11));
+    QCOMPARE(rangeSpy.count(), 0);
+    QCOMPARE(shiftedSpy.count(), 1);
+    arguments = shiftedSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 1);
+    QCOMPARE(arguments.at(1).toInt(), 2);
+    m_series->setMaximumPointCount(0);
+}
+
+void tst_QXYSeries::appendRange_chart()
+{
+    m_view->show();
+    m_chart->addSeries(m_series);
+    QTest::qWaitForWindowShown(m_view);
+    appendRange_raw();
+}
+
+void tst_QXYSeries::replaceRange_raw()
+{
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointsReplaced()));
+
+    const qreal x[] = { 0, 1, 2, 3 };
+    const qreal y[] = { 10, 11, 12, 13 };
+    m_series->replaceRange(x, y, 4);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->at(1), QPointF(1, 11));
+    QCOMPARE(replacedSpy.count(), 1);
+
+    m_series->setMaximumPointCount(2);
+    m_series->replaceRange(x, y, 4);
+    QCOMPARE(m_series->count(), 2);
+    QCOMPARE(m_series->at(0), QPointF(2, 12));
+    QCOMPARE(replacedSpy.count(), 2);
+    m_series->setMaximumPointCount(0);
+}
+
+void tst_QXYSeries::replacePoints_raw()
+{
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointReplaced(int)));
+    QSignalSpy rangeSpy(m_series, SIGNAL(pointRangeReplaced(int,int)));
+
+    for (int i = 0; i < 5; i++)
+        m_series->append(i, i);
+
+    QVector<QPointF> points;
+    points << QPointF(1, 11) << QPointF(qQNaN(), 12) << QPointF(3, 13);
+    m_series->replacePoints(1, points);
+    QCOMPARE(m_series->count(), 5);
+    QCOMPARE(m_series->at(1), QPointF(1, 11));
+    QCOMPARE(m_series->at(2), QPointF(2, 2));
+    QCOMPARE(m_series->at(3), QPointF(3, 13));
+    QRectF bounds;
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF(0, 0, 4, 13));
+    QCOMPARE(replacedSpy.count(), 0);
+    QCOMPARE(rangeSpy.count(), 1);
+    QList<QVariant> arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 1);
+    QCOMPARE(arguments.at(1).toInt(), 3);
+
+    // Points past the end of the series are ignored
+    m_series->replacePoints(3, points);
+    QCOMPARE(m_series->count(), 5);
+    QCOMPARE(m_series->at(4), QPointF(4, 4));
+    QCOMPARE(rangeSpy.count(), 1);
+    arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 3);
+    QCOMPARE(arguments.at(1).toInt(), 2);
+
+    m_series->replacePoints(5, points);
+    m_series->replacePoints(-1, points);
+    QCOMPARE(rangeSpy.count(), 0);
+}
+
+void tst_QXYSeries::replacePoints_chart()
+{
+    m_view->show();
+    m_chart->addSeries(m_series);
+    QTest::qWaitForWindowShown(m_view);
+    replacePoints_raw();
+}
+
+void tst_QXYSeries::insertPoints_raw()
+{
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy rangeSpy(m_series, SIGNAL(pointsAdded(int,int)));
+
+    m_series->append(0, 0);
+    m_series->append(3, 3);
+    QCOMPARE(addedSpy.count(), 2);
+    addedSpy.clear();
+
+    QVector<QPointF> points;
+    points << QPointF(1, 1) << QPointF(qQNaN(), 0) << QPointF(2, 2);
+    m_series->insertPoints(1, points);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(m_series->at(1), QPointF(1, 1));
+    QCOMPARE(m_series->at(2), QPointF(2, 2));
+    QCOMPARE(m_series->at(3), QPointF(3, 3));
+    QCOMPARE(addedSpy.count(), 0);
+    QCOMPARE(rangeSpy.count(), 1);
+    QList<QVariant> arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 1);
+    QCOMPARE(arguments.at(1).toInt(), 2);
+
+    // Inserting past the end appends
+    m_series->insertPoints(100, QVector<QPointF>() << QPointF(4, 4));
+    QCOMPARE(m_series->count(), 5);
+    QCOMPARE(m_series->at(4), QPointF(4, 4));
+    QCOMPARE(rangeSpy.count(), 1);
+    arguments = rangeSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 4);
+    QCOMPARE(arguments.at(1).toInt(), 1);
+
+    m_series->setMaximumPointCount(6);
+    m_series->insertPoints(0, points);
+    QCOMPARE(m_series->count(), 6);
+    QCOMPARE(m_series->at(5), QPointF(4, 4));
+    m_series->setMaximumPointCount(0);
+}
+
+void tst_QXYSeries::nearestPoint_raw()
+{
+    QCOMPARE(m_series->nearestPoint(QPointF(0, 0)), -1);
+
+    m_series->append(0, 0);
+    m_series->append(1, 1);
+    m_series->append(2, 4);
+    m_series->append(3, 9);
+    QCOMPARE(m_series->nearestPoint(QPointF(1.2, 1.1)), 1);
+    QCOMPARE(m_series->nearestPoint(QPointF(100, 100)), 3);
+    // Equally distant points resolve to the first one
+    QCOMPARE(m_series->nearestPoint(QPointF(1.5, 2.5)), 1);
+    QCOMPARE(m_series->nearestPoint(QPointF(1.5, 2.5), 1.0), -1);
+    QCOMPARE(m_series->nearestPoint(QPointF(1.5, 1.5), 1.0), 1);
+
+    // The index follows the changes of the series
+    m_series->append(10, 10);
+    QCOMPARE(m_series->nearestPoint(QPointF(9, 9)), 4);
+    m_series->removePoints(0, 2);
+    QCOMPARE(m_series->nearestPoint(QPointF(9, 9)), 2);
+    QCOMPARE(m_series->nearestPoint(QPointF(0, 0)), 0);
+    m_series->insert(0, QPointF(0, 0));
+    QCOMPARE(m_series->nearestPoint(QPointF(0, 0)), 0);
+    m_series->replace(0, QPointF(30, 30));
+    QCOMPARE(m_series->nearestPoint(QPointF(0, 0)), 1);
+
+    m_series->setMaximumPointCount(3);
+    m_series->append(20, 20);
+    QCOMPARE(m_series->count(), 3);
+    QCOMPARE(m_series->nearestPoint(QPointF(19, 19)), 2);
+    QCOMPARE(m_series->nearestPoint(QPointF(0, 0)), 0);
+    m_series->setMaximumPointCount(0);
+
+    m_series->clear();
+    QCOMPARE(m_series->nearestPoint(QPointF(0, 0)), -1);
+}
+
+void tst_QXYSeries::boundingRect_raw()
+{
+    QRectF bounds(1, 2, 3, 4);
+    QVERIFY(!m_series->boundingRect(&bounds));
+    QVERIFY(!m_series->boundingRect(0, 10, &bounds));
+    QCOMPARE(bounds, QRectF(1, 2, 3, 4));
+
+    // A single point at the origin is not confused with an empty range
+    m_series->append(0, 0);
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF());
+    QVERIFY(m_series->boundingRect(-1, 1, &bounds));
+    QCOMPARE(bounds, QRectF());
+    QVERIFY(!m_series->boundingRect(1, 2, &bounds));
+
+    // Enough points to span several blocks of the bounds summary
+    QVector<QPointF> points;
+    for (int i = 0; i < 1000; i++)
+        points.append(QPointF(i, (i * 37) % 101));
+    m_series->replace(points);
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF(QPointF(0, 0), QPointF(999, 100)));
+    QVERIFY(m_series->boundingRect(10, 20, &bounds));
+    QCOMPARE(bounds, QRectF(QPointF(10, 3), QPointF(20, 97)));
+    QVERIFY(!m_series->boundingRect(2000, 3000, &bounds));
+
+    m_series->append(1000, 200);
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF(QPointF(0, 0), QPointF(1000, 200)));
+    m_series->remove(1000);
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF(QPointF(0, 0), QPointF(999, 100)));
+    m_series->replace(500, QPointF(500, -50));
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF(QPointF(0, -50), QPointF(999, 100)));
+    QVERIFY(m_series->boundingRect(0, 400, &bounds));
+    QCOMPARE(bounds, QRectF(QPointF(0, 0), QPointF(400, 100)));
+    m_series->insert(0, QPointF(-1, 300));
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF(QPointF(-1, -50), QPointF(999, 300)));
+    m_series->removePoints(0, 600);
+    QVERIFY(m_series->boundingRect(&bounds));
+    QCOMPARE(bounds, QRectF(QPointF(599, 0), QPointF(999, 100)));
+
+    // Unsorted series are scanned
+    m_series->append(0, 1000);
+    QVERIFY(m_series->boundingRect(0, 700, &bounds));
+    QCOMPARE(bounds, QRectF(QPointF(0, 0), QPointF(700, 1000)));
+
+    m_series->clear();
+    QVERIFY(!m_series->boundingRect(&bounds));
+}
+
+void tst_QXYSeries::asynchronousGeometry_chart()
+{
+    QSignalSpy spy(m_series, SIGNAL(asynchronousGeometryChanged(bool)));
+    QCOMPARE(m_series->asynchronousGeometry(), false);
+    m_series->setAsynchronousGeometry(true);
+    QCOMPARE(m_series->asynchronousGeometry(), true);
+    m_series->setAsynchronousGeometry(true);
+    QCOMPARE(spy.count(), 1);
+
+    QVector<QPointF> points;
+    QVector<QPointF> otherPoints;
+    for (int i = 0; i < 100000; i++) {
+        points.append(QPointF(i, i % 100));
+        otherPoints.append(QPointF(i, (i * 7) % 50));
+    }
+
+    m_view->show();
+    m_chart->addSeries(m_series);
+    m_chart->createDefaultAxes();
+    m_chart->axisX(m_series)->setRange(0, 100000);
+    m_chart->axisY(m_series)->setRange(0, 100);
+    QTest::qWaitForWindowShown(m_view);
+
+    // Render the geometry built synchronously for both sets of points
+    m_series->setAsynchronousGeometry(false);
+    m_series->replace(points);
+    const QImage pointsImage = m_view->grab().toImage();
+    m_series->replace(otherPoints);
+    const QImage otherPointsImage = m_view->grab().toImage();
+    QVERIFY(pointsImage != otherPointsImage);
+
+    // The geometry built by the worker is the same as the synchronous one
+    m_series->setAsynchronousGeometry(true);
+    m_series->replace(points);
+    QTRY_VERIFY(m_view->grab().toImage() == pointsImage);
+
+    // Updates while a build is running are coalesced into one more build from the latest points
+    m_series->replace(otherPoints);
+    m_series->replace(points);
+    m_series->replace(otherPoints);
+    QTRY_VERIFY(m_view->grab().toImage() == otherPointsImage);
+    QTest::qWait(200);
+    QVERIFY(m_view->grab().toImage() == otherPointsImage);
+
+    // A synchronous update while a build is running discards the stale result
+    m_series->replace(points);
+    m_series->setAsynchronousGeometry(false);
+    QCOMPARE(spy.count(), 4);
+    m_series->replace(otherPoints);
+    QVERIFY(m_view->grab().toImage() == otherPointsImage);
+    QTest::qWait(200);
+    QVERIFY(m_view->grab().toImage() == otherPointsImage);
+
+    // Removing the series while a build is running discards the result
+    m_series->setAsynchronousGeometry(true);
+    m_series->replace(points);
+    m_chart->removeSeries(m_series);
+    QTest::qWait(200);
+    QCOMPARE(m_series->count(), points.count());
+
+    m_chart->addSeries(m_series);
+    m_series->setAsynchronousGeometry(false);
+    QCOMPARE(spy.count(), 6);
+    m_series->append(100000, 50);
+    QTest::qWait(100);
+}
+
+void tst_QXYSeries::nearestPoint_chart()
+{
+    m_series->append(0, 0);
+    m_series->append(1, 100);
+    m_view->show();
+    m_chart->addSeries(m_series);
+    QTest::qWaitForWindowShown(m_view);
+
+    // In a chart the distances are measured on screen, where the y values are compressed
+    QCOMPARE(m_series->nearestPoint(QPointF(0.95, 30)), 1);
+    const QPointF position = m_chart->mapToPosition(QPointF(1, 100), m_series);
+    const QPointF value = m_chart->mapToValue(position + QPointF(3, 0), m_series);
+    QCOMPARE(m_series->nearestPoint(value, 5), 1);
+    QCOMPARE(m_series->nearestPoint(value, 2), -1);
+}
+
+void tst_QXYSeries::nearestPoint_logChart()
+{
+    m_series->append(1, 0);
+    m_series->append(10, 0);
+    m_series->append(100, 0);
+    m_chart->addSeries(m_series);
+    QLogValueAxis *axisX = new QLogValueAxis;
+    m_chart->setAxisX(axisX, m_series);
+    axisX->setRange(1, 1000);
+    QValueAxis *axisY = new QValueAxis;
+    m_chart->setAxisY(axisY, m_series);
+    axisY->setRange(-1, 1);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    // On a log axis 50 is nearer to 100 than to 10
+    QCOMPARE(m_series->nearestPoint(QPointF(50, 0)), 2);
+
+    // The cached geometry points follow the changes of the series and the domain
+    m_series->append(1000, 0);
+    QCOMPARE(m_series->nearestPoint(QPointF(600, 0)), 3);
+    m_series->remove(0);
+    QCOMPARE(m_series->nearestPoint(QPointF(50, 0)), 1);
+    m_series->replace(1, QPointF(20, 0));
+    QCOMPARE(m_series->nearestPoint(QPointF(50, 0)), 1);
+    QCOMPARE(m_series->nearestPoint(QPointF(400, 0)), 2);
+    axisX->setRange(1, 100);
+    QCOMPARE(m_series->nearestPoint(QPointF(50, 0)), 1);
+    QCOMPARE(m_series->nearestPoint(QPointF(11, 0)), 0);
+}
@@ -33,6 +33,8 @@
 #include <QtTest/QtTest>
 #include <QtCharts/QXYSeries>
 #include <QtCharts/QChartView>
+#include <QtCharts/QLogValueAxis>
+#include <QtCharts/QValueAxis>
 #include <QtGui/QStandardItemModel>
 #include <tst_definitions.h>
 
@@ -94,6 +96,21 @@ private slots:
     void insert_data();
     void insert();
     void changedSignals();
+    void maximumPointCount_raw();
+    void maximumPointCount_chart();
+    void decimationMode_raw();
+    void decimationMode_chart();
+    void appendRange_raw();
+    void appendRange_chart();
+    void replaceRange_raw();
+    void replacePoints_raw();
+    void replacePoints_chart();
+    void insertPoints_raw();
+    void nearestPoint_raw();
+    void nearestPoint_chart();
+    void nearestPoint_logChart();
+    void boundingRect_raw();
+    void asynchronousGeometry_chart();
 protected:
     void append_data();
     void count_data();
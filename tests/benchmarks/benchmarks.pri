@@ -0,0 +1,7 @@
+!include( ../tests.pri ) {
+    error( "Couldn't find the tests.pri file!" )
+}
+
+QT += testlib widgets
+
+!contains(TARGET, ^tst_.*):TARGET = $$join(TARGET,,"tst_bench_")
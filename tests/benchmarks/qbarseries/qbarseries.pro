@@ -0,0 +1,6 @@
+!include( ../benchmarks.pri ) {
+    error( "Couldn't find the benchmarks.pri file!" )
+}
+
+SOURCES += \
+    tst_bench_qbarseries.cpp
@@ -0,0 +1,214 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QBarSeries>
+#include <QtCharts/QStackedBarSeries>
+#include <QtCharts/QPercentBarSeries>
+#include <QtCharts/QBarSet>
+
+QT_CHARTS_USE_NAMESPACE
+
+Q_DECLARE_METATYPE(QAbstractSeries::SeriesType)
+
+class tst_bench_QBarSeries : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void replaceValue_data();
+    void replaceValue();
+    void replaceRange_data();
+    void replaceRange();
+    void layout_data();
+    void layout();
+    void appendTakeSet_data();
+    void appendTakeSet();
+
+private:
+    void addRows();
+    void createSeries(QAbstractSeries::SeriesType type, int setCount, int categoryCount);
+
+    QAbstractBarSeries *m_series;
+    QChartView *m_view;
+};
+
+void tst_bench_QBarSeries::addRows()
+{
+    QTest::addColumn<QAbstractSeries::SeriesType>("type");
+    QTest::addColumn<int>("setCount");
+    QTest::addColumn<int>("categoryCount");
+    QTest::newRow("bar, 10 sets, 1k categories") << QAbstractSeries::SeriesTypeBar << 10 << 1000;
+    QTest::newRow("bar, 100 sets, 100 categories") << QAbstractSeries::SeriesTypeBar << 100 << 100;
+    QTest::newRow("stacked, 10 sets, 1k categories") << QAbstractSeries::SeriesTypeStackedBar << 10 << 1000;
+    QTest::newRow("stacked, 100 sets, 100 categories") << QAbstractSeries::SeriesTypeStackedBar << 100 << 100;
+    QTest::newRow("percent, 10 sets, 1k categories") << QAbstractSeries::SeriesTypePercentBar << 10 << 1000;
+    QTest::newRow("percent, 100 sets, 100 categories") << QAbstractSeries::SeriesTypePercentBar << 100 << 100;
+}
+
+void tst_bench_QBarSeries::createSeries(QAbstractSeries::SeriesType type, int setCount, int categoryCount)
+{
+    switch (type) {
+    case QAbstractSeries::SeriesTypeStackedBar:
+        m_series = new QStackedBarSeries;
+        break;
+    case QAbstractSeries::SeriesTypePercentBar:
+        m_series = new QPercentBarSeries;
+        break;
+    default:
+        m_series = new QBarSeries;
+        break;
+    }
+
+    QList<QBarSet *> sets;
+    for (int s = 0; s < setCount; s++) {
+        QBarSet *set = new QBarSet(QString("set %1").arg(s));
+        for (int c = 0; c < categoryCount; c++)
+            set->append(1 + qAbs(qSin(s + c * 0.01)));
+        sets << set;
+    }
+    m_series->append(sets);
+
+    QChart *chart = new QChart;
+    chart->addSeries(m_series);
+    chart->createDefaultAxes();
+    m_view = new QChartView(chart);
+    m_view->resize(800, 600);
+}
+
+void tst_bench_QBarSeries::init()
+{
+    m_series = 0;
+    m_view = 0;
+}
+
+void tst_bench_QBarSeries::cleanup()
+{
+    delete m_view;
+}
+
+void tst_bench_QBarSeries::replaceValue_data()
+{
+    addRows();
+}
+
+void tst_bench_QBarSeries::replaceValue()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, setCount);
+    QFETCH(int, categoryCount);
+    createSeries(type, setCount, categoryCount);
+
+    // Each replaced value triggers one layout pass over all bars
+    QBarSet *set = m_series->barSets().at(setCount / 2);
+    int category = 0;
+    QBENCHMARK {
+        set->replace(category, set->at(category) + 1);
+        category = (category + 1) % categoryCount;
+    }
+    QCOMPARE(m_series->count(), setCount);
+}
+
+void tst_bench_QBarSeries::replaceRange_data()
+{
+    addRows();
+}
+
+void tst_bench_QBarSeries::replaceRange()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, setCount);
+    QFETCH(int, categoryCount);
+    createSeries(type, setCount, categoryCount);
+
+    // All values of a set are replaced with one call, which triggers a single layout pass
+    QBarSet *set = m_series->barSets().at(setCount / 2);
+    QVector<qreal> values(categoryCount);
+    for (int c = 0; c < categoryCount; c++)
+        values[c] = 1 + qAbs(qCos(c * 0.01));
+    QBENCHMARK {
+        set->replace(0, values.constData(), values.count());
+    }
+    QCOMPARE(set->at(0), values.at(0));
+}
+
+void tst_bench_QBarSeries::layout_data()
+{
+    addRows();
+}
+
+void tst_bench_QBarSeries::layout()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, setCount);
+    QFETCH(int, categoryCount);
+    createSeries(type, setCount, categoryCount);
+
+    // Changing the bar width lays the bars out again without touching the values
+    qreal width = 0.5;
+    QBENCHMARK {
+        width = width == 0.5 ? 0.6 : 0.5;
+        m_series->setBarWidth(width);
+    }
+    QCOMPARE(m_series->barSets().at(0)->count(), categoryCount);
+}
+
+void tst_bench_QBarSeries::appendTakeSet_data()
+{
+    addRows();
+}
+
+void tst_bench_QBarSeries::appendTakeSet()
+{
+    QFETCH(QAbstractSeries::SeriesType, type);
+    QFETCH(int, setCount);
+    QFETCH(int, categoryCount);
+    createSeries(type, setCount, categoryCount);
+
+    // Both calls change the structure of the series, which rebuilds the bars of the chart item
+    QBarSet set(QString("extra"));
+    for (int c = 0; c < categoryCount; c++)
+        set.append(c % 10);
+    QBENCHMARK {
+        m_series->append(&set);
+        m_series->take(&set);
+    }
+    QCOMPARE(m_series->count(), setCount);
+}
+
+QTEST_MAIN(tst_bench_QBarSeries)
+
+#include "tst_bench_qbarseries.moc"
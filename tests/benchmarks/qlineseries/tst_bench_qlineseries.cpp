@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCore/QtMath>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_bench_QLineSeries : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void append_data();
+    void append();
+
+private:
+    QChartView *m_view;
+};
+
+void tst_bench_QLineSeries::init()
+{
+    m_view = new QChartView(new QChart);
+    m_view->resize(800, 600);
+}
+
+void tst_bench_QLineSeries::cleanup()
+{
+    delete m_view;
+    m_view = 0;
+}
+
+void tst_bench_QLineSeries::append_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("10000") << 10000;
+    QTest::newRow("200000") << 200000;
+}
+
+void tst_bench_QLineSeries::append()
+{
+    // Appending a point to a displayed series should cost the same regardless of the series size
+    QFETCH(int, count);
+
+    QVector<QPointF> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++)
+        points.append(QPointF(i, qSin(i / 100.0)));
+
+    QLineSeries *series = new QLineSeries;
+    series->replace(points);
+    m_view->chart()->addSeries(series);
+    m_view->chart()->createDefaultAxes();
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    int x = count;
+    QBENCHMARK {
+        series->append(x, qSin(x / 100.0));
+        x++;
+    }
+    QCOMPARE(series->count(), x);
+}
+
+QTEST_MAIN(tst_bench_QLineSeries)
+
+#include "tst_bench_qlineseries.moc"
@@ -0,0 +1,240 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QVXYModelMapper>
+#include <QtCharts/QModelSectionReader>
+#include <QtGui/QStandardItemModel>
+
+QT_CHARTS_USE_NAMESPACE
+
+// Table of x and y columns stored as numbers
+class ColumnModel : public QAbstractTableModel, public QModelSectionReader
+{
+    Q_OBJECT
+    Q_INTERFACES(QtCharts::QModelSectionReader)
+
+public:
+    ColumnModel(int rowCount, bool sectionReader)
+        : m_sectionReader(sectionReader)
+    {
+        m_columns[0].resize(rowCount);
+        m_columns[1].resize(rowCount);
+        for (int row = 0; row < rowCount; row++) {
+            m_columns[0][row] = row;
+            m_columns[1][row] = qSin(row * 0.01);
+        }
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const
+    {
+        return parent.isValid() ? 0 : m_columns[0].count();
+    }
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const
+    {
+        return parent.isValid() ? 0 : 2;
+    }
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const
+    {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        return m_columns[index.column()].at(index.row());
+    }
+
+    void reset()
+    {
+        beginResetModel();
+        endResetModel();
+    }
+
+    bool readSection(Qt::Orientation orientation, int section, int first, int count,
+                     qreal *values, int stride) const
+    {
+        if (!m_sectionReader || orientation != Qt::Vertical)
+            return false;
+        const qreal *column = m_columns[section].constData() + first;
+        for (int i = 0; i < count; i++)
+            values[i * stride] = column[i];
+        return true;
+    }
+
+private:
+    QVector<qreal> m_columns[2];
+    bool m_sectionReader;
+};
+
+class tst_bench_QXYModelMapper : public QObject
+{
+    Q_OBJECT
+
+public slots:
+    void init();
+    void cleanup();
+
+private slots:
+    void dataChanged_data();
+    void dataChanged();
+    void insertRemoveRows_data();
+    void insertRemoveRows();
+    void initialize_data();
+    void initialize();
+
+private:
+    void createModel(int rowCount);
+
+    QStandardItemModel *m_model;
+    QLineSeries *m_series;
+    QVXYModelMapper *m_mapper;
+    QChartView *m_view;
+};
+
+void tst_bench_QXYModelMapper::createModel(int rowCount)
+{
+    m_model = new QStandardItemModel(rowCount, 2, this);
+    for (int row = 0; row < rowCount; row++) {
+        m_model->setData(m_model->index(row, 0), row);
+        m_model->setData(m_model->index(row, 1), qSin(row * 0.01));
+    }
+
+    m_series = new QLineSeries;
+    m_mapper = new QVXYModelMapper(this);
+    m_mapper->setXColumn(0);
+    m_mapper->setYColumn(1);
+    m_mapper->setModel(m_model);
+    m_mapper->setSeries(m_series);
+
+    QChart *chart = new QChart;
+    chart->addSeries(m_series);
+    chart->createDefaultAxes();
+    m_view = new QChartView(chart);
+    m_view->resize(800, 600);
+}
+
+void tst_bench_QXYModelMapper::init()
+{
+    m_model = 0;
+    m_series = 0;
+    m_mapper = 0;
+    m_view = 0;
+}
+
+void tst_bench_QXYModelMapper::cleanup()
+{
+    delete m_mapper;
+    delete m_view;
+    delete m_model;
+}
+
+void tst_bench_QXYModelMapper::dataChanged_data()
+{
+    QTest::addColumn<int>("rowCount");
+    QTest::addColumn<int>("changedCount");
+    QTest::newRow("100k rows, 1 changed") << 100000 << 1;
+    QTest::newRow("100k rows, 10k changed") << 100000 << 10000;
+    QTest::newRow("100k rows, all changed") << 100000 << 100000;
+}
+
+void tst_bench_QXYModelMapper::dataChanged()
+{
+    QFETCH(int, rowCount);
+    QFETCH(int, changedCount);
+    createModel(rowCount);
+    QCOMPARE(m_series->count(), rowCount);
+
+    // Change the values without notifying, so that the benchmark measures only the handling of
+    // one dataChanged() covering all the changed rows
+    const int first = (rowCount - changedCount) / 2;
+    m_model->blockSignals(true);
+    for (int row = first; row < first + changedCount; row++)
+        m_model->setData(m_model->index(row, 1), qCos(row * 0.01));
+    m_model->blockSignals(false);
+
+    QBENCHMARK {
+        emit m_model->dataChanged(m_model->index(first, 0),
+                                  m_model->index(first + changedCount - 1, 1));
+    }
+    QCOMPARE(m_series->at(first).y(), qCos(first * 0.01));
+}
+
+void tst_bench_QXYModelMapper::insertRemoveRows_data()
+{
+    QTest::addColumn<int>("rowCount");
+    QTest::addColumn<int>("insertedCount");
+    QTest::newRow("100k rows, 1k inserted") << 100000 << 1000;
+    QTest::newRow("100k rows, 10k inserted") << 100000 << 10000;
+}
+
+void tst_bench_QXYModelMapper::insertRemoveRows()
+{
+    QFETCH(int, rowCount);
+    QFETCH(int, insertedCount);
+    createModel(rowCount);
+
+    QBENCHMARK {
+        m_model->insertRows(rowCount / 2, insertedCount);
+        m_model->removeRows(rowCount / 2, insertedCount);
+    }
+    QCOMPARE(m_series->count(), rowCount);
+}
+
+void tst_bench_QXYModelMapper::initialize_data()
+{
+    QTest::addColumn<int>("rowCount");
+    QTest::addColumn<bool>("sectionReader");
+    QTest::newRow("1M rows, data()") << 1000000 << false;
+    QTest::newRow("1M rows, section reader") << 1000000 << true;
+}
+
+void tst_bench_QXYModelMapper::initialize()
+{
+    QFETCH(int, rowCount);
+    QFETCH(bool, sectionReader);
+    ColumnModel model(rowCount, sectionReader);
+    QLineSeries series;
+    QVXYModelMapper mapper;
+    mapper.setXColumn(0);
+    mapper.setYColumn(1);
+    mapper.setSeries(&series);
+    mapper.setModel(&model);
+
+    QBENCHMARK {
+        model.reset();
+    }
+    QCOMPARE(series.count(), rowCount);
+}
+
+QTEST_MAIN(tst_bench_QXYModelMapper)
+
+#include "tst_bench_qxymodelmapper.moc"